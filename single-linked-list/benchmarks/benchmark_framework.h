@@ -0,0 +1,148 @@
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../heap-allocation-counter.h"
+
+#ifdef __linux__
+#include <sys/resource.h>
+#endif
+
+// Пространство имён для бенчмарков
+namespace benchmarks {
+
+// Функция, не дающая компилятору выбросить вычисление значения
+template <typename T>
+void DoNotOptimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// Функция замера времени выполнения функции (в наносекундах)
+template <typename Function>
+double MeasureNs(Function function) {
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const auto finish = std::chrono::steady_clock::now();
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start).count());
+}
+
+// Сброс пикового объёма резидентной памяти процесса (Linux: запись "5" в /proc/self/clear_refs)
+inline void ResetPeakRss() {
+#ifdef __linux__
+    std::ofstream clear_refs("/proc/self/clear_refs");
+    clear_refs << "5";
+#endif
+}
+
+// Пиковый объём резидентной памяти процесса в килобайтах (0, если неизвестен)
+inline size_t GetPeakRssKb() {
+#ifdef __linux__
+    using namespace std;
+    ifstream status("/proc/self/status");
+    for (string line; getline(status, line);) {
+        if (line.rfind("VmHWM:"s, 0) == 0) {
+            return static_cast<size_t>(stoull(line.substr(6)));
+        }
+    }
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return static_cast<size_t>(usage.ru_maxrss);
+#else
+    return 0u;
+#endif
+}
+
+// Результат бенчмарка
+struct BenchmarkResult {
+    std::string name;          // Название бенчмарка
+    std::string type;          // Тип элементов
+    size_t size = 0u;          // Размер списка
+    size_t ops = 0u;           // Количество операций
+    double ns_per_op = 0.0;    // Время на операцию
+    double allocations_per_op = 0.0; // Выделений памяти на операцию
+    size_t peak_rss_kb = 0u;   // Пиковый объём резидентной памяти во время замера
+};
+
+// Класс запуска бенчмарков: замеряет время, выделения памяти и пиковую память, собирает результаты
+class BenchmarkRunner {
+public:
+    // Конструктор: запускаются только бенчмарки, в названии которых есть подстрока filter
+    explicit BenchmarkRunner(std::string filter = {}) : filter_(std::move(filter)) { }
+
+    // Проверка того, что бенчмарк с таким названием будет запущен
+    [[nodiscard]] bool IsEnabled(const std::string& name) const {
+        return filter_.empty() || name.find(filter_) != std::string::npos;
+    }
+
+    // Запуск бенчмарка: function выполняет ops операций над списком размера size с элементами типа type
+    template <typename Function>
+    void Run(const std::string& name, const std::string& type, size_t size, size_t ops, Function function) {
+        if (!IsEnabled(name)) {
+            return;
+        }
+
+        ResetPeakRss();
+        const size_t allocations_before = heap_allocation_counter::GetAllocationCount();
+        const double total_ns = MeasureNs(function);
+        const size_t allocations = heap_allocation_counter::GetAllocationCount() - allocations_before;
+
+        BenchmarkResult result;
+        result.name = name;
+        result.type = type;
+        result.size = size;
+        result.ops = ops;
+        result.ns_per_op = ops > 0u ? total_ns / static_cast<double>(ops) : total_ns;
+        result.allocations_per_op = ops > 0u ? static_cast<double>(allocations) / static_cast<double>(ops) : 0.0;
+        result.peak_rss_kb = GetPeakRssKb();
+        Print(result);
+        results_.push_back(std::move(result));
+    }
+
+    // Результаты всех запущенных бенчмарков
+    [[nodiscard]] const std::vector<BenchmarkResult>& GetResults() const noexcept { return results_; }
+
+    // Вывод результатов в формате JSON
+    void WriteJson(std::ostream& os) const {
+        using namespace std;
+        os << "[\n"s;
+        for (size_t i = 0u; i < results_.size(); ++i) {
+            const BenchmarkResult& r = results_[i];
+            os << "  {\"name\": \""s << r.name << "\", \"type\": \""s << r.type << "\", \"size\": "s << r.size
+               << ", \"ops\": "s << r.ops << ", \"ns_per_op\": "s << r.ns_per_op
+               << ", \"allocations_per_op\": "s << r.allocations_per_op << ", \"peak_rss_kb\": "s << r.peak_rss_kb << "}"s
+               << (i + 1u < results_.size() ? ",\n"s : "\n"s);
+        }
+        os << "]\n"s;
+    }
+
+    // Вывод результатов в формате CSV
+    void WriteCsv(std::ostream& os) const {
+        using namespace std;
+        os << "name,type,size,ops,ns_per_op,allocations_per_op,peak_rss_kb\n"s;
+        for (const BenchmarkResult& r : results_) {
+            os << '"' << r.name << "\","s << r.type << ',' << r.size << ',' << r.ops << ',' << r.ns_per_op << ','
+               << r.allocations_per_op << ',' << r.peak_rss_kb << '\n';
+        }
+    }
+
+private:
+    std::string filter_;
+    std::vector<BenchmarkResult> results_;
+
+    // Вывод результата бенчмарка в консоль
+    static void Print(const BenchmarkResult& r) {
+        using namespace std;
+        cout << left << setw(52) << r.name << setw(8) << r.type << right << setw(10) << r.size
+             << setw(12) << fixed << setprecision(2) << r.ns_per_op << " ns/op"s
+             << setw(8) << setprecision(2) << r.allocations_per_op << " allocs/op"s
+             << setw(10) << r.peak_rss_kb << " KB peak"s << endl;
+    }
+};
+
+}
\ No newline at end of file
@@ -0,0 +1,771 @@
+// Бенчмарки односвязного списка и его вариантов.
+// Сборка: g++ -std=c++17 -O2 -DNDEBUG -pthread benchmarks/*.cpp heap-allocation-counter.cpp -o benchmarks
+// Запуск: ./benchmarks [--sizes=N1,N2,...] [--filter=подстрока] [--json=файл] [--csv=файл] [N...]
+// (размеры по умолчанию: 1000, 100000 и 1000000)
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "benchmark_framework.h"
+#include "../single-linked-list.h"
+#include "../node-pool-allocator.h"
+#include "../unrolled-single-linked-list.h"
+#include "../compact-single-linked-list.h"
+#include "../indexed-single-linked-list.h"
+#include "../small-single-linked-list.h"
+#include "../persistent-single-linked-list.h"
+#include "../single-linked-list-hash-map.h"
+#include "../intrusive-single-linked-list.h"
+#include "../concurrent-single-linked-list.h"
+#include "../mpsc-queue.h"
+#include "../single-linked-list-parallel.h"
+#include "../single-linked-list-serialization.h"
+using namespace std;
+
+// Подопытная структура для создания листа из таких структур (как в main.cpp)
+struct Point {
+    int x = 0;
+    int y = 0;
+};
+
+bool operator == (const Point& lhs, const Point& rhs) { return lhs.x == rhs.x && lhs.y == rhs.y; }
+bool operator < (const Point& lhs, const Point& rhs) { return lhs.x < rhs.x || (lhs.x == rhs.x && lhs.y < rhs.y); }
+
+// Пространство имён для бенчмарков
+namespace benchmarks {
+
+// Название и создание i-го значения для каждого типа элементов
+template <typename Type>
+struct ValueTraits;
+
+template <>
+struct ValueTraits<int> {
+    static string Name() { return "int"s; }
+    static int Make(size_t i) { return static_cast<int>(i); }
+};
+
+template <>
+struct ValueTraits<Point> {
+    static string Name() { return "Point"s; }
+    static Point Make(size_t i) { return { static_cast<int>(i), -static_cast<int>(i) }; }
+};
+
+template <>
+struct ValueTraits<string> {
+    static string Name() { return "string"s; }
+    // Строки длиннее буфера малых строк, чтобы каждая копия выделяла память
+    static string Make(size_t i) { return "benchmark value number "s + to_string(i); }
+};
+
+// Функция создания вектора из size значений типа Type
+template <typename Type>
+vector<Type> MakeValues(size_t size) {
+    vector<Type> values;
+    values.reserve(size);
+    for (size_t i = 0u; i < size; ++i) {
+        values.push_back(ValueTraits<Type>::Make(i));
+    }
+    return values;
+}
+
+// Функция создания списка из значений вектора
+template <typename List, typename Type>
+List MakeList(const vector<Type>& values) {
+    List lst;
+    for (const Type& value : values) {
+        lst.PushBack(value);
+    }
+    return lst;
+}
+
+// Бенчмарки основных операций SingleLinkedList с элементами типа Type
+template <typename Type>
+void BenchmarkListOperations(BenchmarkRunner& runner, size_t size) {
+    const string type = ValueTraits<Type>::Name();
+    const vector<Type> values = MakeValues<Type>(size);
+
+    {
+        SingleLinkedList<Type> lst;
+        runner.Run("SingleLinkedList::PushFront"s, type, size, size, [&lst, &values] {
+            for (const Type& value : values) lst.PushFront(value);
+        });
+    }
+    {
+        SingleLinkedList<Type> lst;
+        runner.Run("SingleLinkedList::PushBack"s, type, size, size, [&lst, &values] {
+            for (const Type& value : values) lst.PushBack(value);
+        });
+    }
+    {
+        SingleLinkedList<Type> lst{ values.front() };
+        runner.Run("SingleLinkedList::InsertAfter"s, type, size, size, [&lst, &values] {
+            const auto pos = lst.cbegin();
+            for (const Type& value : values) lst.InsertAfter(pos, value);
+        });
+    }
+    {
+        auto lst = MakeList<SingleLinkedList<Type>>(values);
+        runner.Run("SingleLinkedList::EraseAfter"s, type, size, size, [&lst, size] {
+            for (size_t i = 0u; i < size; ++i) lst.EraseAfter(lst.cbefore_begin());
+        });
+    }
+    {
+        auto lst = MakeList<SingleLinkedList<Type>>(values);
+        runner.Run("SingleLinkedList::Clear"s, type, size, size, [&lst] { lst.Clear(); });
+    }
+
+    const auto lst = MakeList<SingleLinkedList<Type>>(values);
+    {
+        SingleLinkedList<Type> copy;
+        runner.Run("SingleLinkedList copy constructor"s, type, size, size, [&lst, &copy] {
+            SingleLinkedList<Type> tmp(lst);
+            copy.swap(tmp);
+        });
+        runner.Run("SingleLinkedList copy assignment (same size)"s, type, size, size, [&lst, &copy] { copy = lst; });
+        runner.Run("SingleLinkedList iteration"s, type, size, size, [&lst] {
+            for (const Type& value : lst) DoNotOptimize(value);
+        });
+        runner.Run("SingleLinkedList operator =="s, type, size, size, [&lst, &copy] { DoNotOptimize(lst == copy); });
+        runner.Run("SingleLinkedList operator <"s, type, size, size, [&lst, &copy] { DoNotOptimize(lst < copy); });
+    }
+}
+
+// Бенчмарки основных операций SingleLinkedList для всех типов элементов
+void RunBenchmarkListOperations(BenchmarkRunner& runner, size_t size) {
+    BenchmarkListOperations<int>(runner, size);
+    BenchmarkListOperations<Point>(runner, size);
+    BenchmarkListOperations<string>(runner, size);
+}
+
+// Бенчмарк обхода и сравнения списка типа List из size целых чисел
+template <typename List>
+void BenchmarkScan(BenchmarkRunner& runner, const string& list_name, size_t size) {
+    const List lst = MakeList<List>(MakeValues<int>(size));
+    const List copy(lst);
+
+    runner.Run(list_name + " scan"s, "int"s, size, size, [&lst] {
+        long long sum = 0;
+        for (int value : lst) {
+            sum += value;
+        }
+        DoNotOptimize(sum);
+    });
+    runner.Run(list_name + " operator =="s, "int"s, size, size, [&lst, &copy] { DoNotOptimize(lst == copy); });
+    runner.Run(list_name + " operator <"s, "int"s, size, size, [&lst, &copy] { DoNotOptimize(lst < copy); });
+}
+
+// Бенчмарки обхода развёрнутого списка в сравнении с SingleLinkedList
+void RunBenchmarkScan(BenchmarkRunner& runner, size_t size) {
+    BenchmarkScan<SingleLinkedList<int>>(runner, "SingleLinkedList"s, size);
+    BenchmarkScan<UnrolledSingleLinkedList<int, 16u>>(runner, "UnrolledSingleLinkedList<16>"s, size);
+    BenchmarkScan<UnrolledSingleLinkedList<int, 64u>>(runner, "UnrolledSingleLinkedList<64>"s, size);
+}
+
+// Функция создания списка из size целых чисел, в котором каждый элемент вставлен после случайного
+// уже вставленного: порядок узлов в списке не совпадает с порядком их размещения в памяти
+template <typename List>
+List MakeShuffledList(size_t size) {
+    mt19937 generator(42);
+    List lst;
+    vector<typename List::ConstIterator> positions;
+    positions.reserve(size + 1u);
+    positions.push_back(lst.cbefore_begin());
+    for (size_t i = 0u; i < size; ++i) {
+        const size_t pos = uniform_int_distribution<size_t>(0u, positions.size() - 1u)(generator);
+        positions.push_back(lst.InsertAfter(positions[pos], static_cast<int>(i)));
+    }
+    return lst;
+}
+
+// Бенчмарк памяти и обхода списка типа List: построение (пиковая память даёт байты на элемент),
+// обход списка, построенного по порядку, и списка с перемешанным порядком узлов
+template <typename List>
+void BenchmarkLayout(BenchmarkRunner& runner, const string& list_name, size_t size) {
+    runner.Run(list_name + " build (PushBack)"s, "int"s, size, size, [size] {
+        List lst;
+        for (size_t i = 0u; i < size; ++i) {
+            lst.PushBack(static_cast<int>(i));
+        }
+        DoNotOptimize(lst.back());
+    });
+
+    const auto scan = [](const List& lst) {
+        long long sum = 0;
+        for (int value : lst) {
+            sum += value;
+        }
+        DoNotOptimize(sum);
+    };
+    const List sequential = MakeList<List>(MakeValues<int>(size));
+    runner.Run(list_name + " scan (sequential)"s, "int"s, size, size, [&sequential, &scan] { scan(sequential); });
+    const List shuffled = MakeShuffledList<List>(size);
+    runner.Run(list_name + " scan (shuffled)"s, "int"s, size, size, [&shuffled, &scan] { scan(shuffled); });
+}
+
+// Бенчмарки компактного списка с 32-битными индексами в сравнении с SingleLinkedList
+void RunBenchmarkCompact(BenchmarkRunner& runner, size_t size) {
+    BenchmarkLayout<SingleLinkedList<int>>(runner, "SingleLinkedList"s, size);
+    BenchmarkLayout<CompactSingleLinkedList<int>>(runner, "CompactSingleLinkedList"s, size);
+}
+
+// Бенчмарки проходов по списку, узлы которого перемешаны в памяти (список не помещается в кэш и
+// каждый переход по next_node - промах): очистка, копирование, сравнения и вывод в поток
+void RunBenchmarkShuffledTraversal(BenchmarkRunner& runner, size_t size) {
+    using List = SingleLinkedList<int>;
+    const List lst = MakeShuffledList<List>(size);
+    const List copy = MakeShuffledList<List>(size);
+
+    runner.Run("shuffled SingleLinkedList copy constructor"s, "int"s, size, size, [&lst] { DoNotOptimize(List(lst).GetSize()); });
+    runner.Run("shuffled SingleLinkedList operator =="s, "int"s, size, size, [&lst, &copy] { DoNotOptimize(lst == copy); });
+    runner.Run("shuffled SingleLinkedList operator <"s, "int"s, size, size, [&lst, &copy] { DoNotOptimize(lst < copy); });
+    runner.Run("shuffled SingleLinkedList operator <<"s, "int"s, size, size, [&lst] {
+        ostringstream out;
+        out << lst;
+        DoNotOptimize(out.tellp());
+    });
+    {
+        List cleared = MakeShuffledList<List>(size);
+        runner.Run("shuffled SingleLinkedList::Clear"s, "int"s, size, size, [&cleared] { cleared.Clear(); });
+    }
+}
+
+// Бенчмарк копирования списка с перемешанными узлами и прохода по копии. Аллокатор с пулом резервирует
+// под копию блоки подряд, поэтому проход по копии идёт по памяти последовательно
+template <typename List>
+void BenchmarkCopyAndScan(BenchmarkRunner& runner, const string& list_name, size_t size) {
+    const List lst = MakeShuffledList<List>(size);
+    runner.Run(list_name + " copy of shuffled + scan"s, "int"s, size, size, [&lst] {
+        const List copy(lst);
+        long long sum = 0;
+        for (int value : copy) {
+            sum += value;
+        }
+        DoNotOptimize(sum);
+    });
+}
+
+// Бенчмарки копирования: SingleLinkedList с std::allocator и с NodePoolAllocator
+void RunBenchmarkPoolCopy(BenchmarkRunner& runner, size_t size) {
+    BenchmarkCopyAndScan<SingleLinkedList<int>>(runner, "SingleLinkedList"s, size);
+    BenchmarkCopyAndScan<SingleLinkedList<int, NodePoolAllocator<int>>>(runner, "SingleLinkedList<NodePoolAllocator>"s, size);
+}
+
+// Бенчмарки доступа по номеру: IndexedSingleLinkedList::At против прохода std::next от начала
+// SingleLinkedList, и вставки в случайные позиции с обновлением индекса
+void RunBenchmarkIndexed(BenchmarkRunner& runner, size_t size) {
+    const vector<int> values = MakeValues<int>(size);
+    const size_t lookups = 1000u;
+    vector<size_t> positions(lookups);
+    mt19937 generator(42);
+    for (size_t& position : positions) {
+        position = uniform_int_distribution<size_t>(0u, size - 1u)(generator);
+    }
+
+    const auto lst = MakeList<SingleLinkedList<int>>(values);
+    // Проход от начала дорог на больших списках, поэтому обращений меньше, но не больше, чем позиций
+    const size_t slow_lookups = min(max<size_t>(1u, lookups * 1000u / size), positions.size());
+    runner.Run("SingleLinkedList std::next(begin(), k)"s, "int"s, size, slow_lookups, [&lst, &positions, slow_lookups] {
+        for (size_t i = 0u; i < slow_lookups; ++i) {
+            DoNotOptimize(*std::next(lst.begin(), static_cast<std::ptrdiff_t>(positions[i])));
+        }
+    });
+
+    IndexedSingleLinkedList<int> indexed(MakeList<SingleLinkedList<int>>(values));
+    runner.Run("IndexedSingleLinkedList index build"s, "int"s, size, size, [&indexed] { DoNotOptimize(indexed.At(0u)); });
+    runner.Run("IndexedSingleLinkedList::At"s, "int"s, size, lookups, [&indexed, &positions] {
+        for (size_t position : positions) {
+            DoNotOptimize(indexed.At(position));
+        }
+    });
+    runner.Run("IndexedSingleLinkedList::InsertAfter(IteratorAt(k))"s, "int"s, size, lookups, [&indexed, &positions] {
+        for (size_t position : positions) {
+            indexed.InsertAfter(indexed.IteratorAt(position), 0);
+        }
+    });
+}
+
+// Бенчмарк коротких списков: создание, проход и разрушение size списков по 1-4 элемента
+template <typename List>
+void BenchmarkShortLists(BenchmarkRunner& runner, const string& list_name, size_t size) {
+    runner.Run(list_name + " build + scan + destroy (1-4 elements)"s, "int"s, size, size, [size] {
+        long long sum = 0;
+        for (size_t i = 0u; i < size; ++i) {
+            List lst;
+            const int count = static_cast<int>(i % 4u) + 1;
+            for (int value = 0; value < count; ++value) {
+                lst.PushBack(value);
+            }
+            for (int value : lst) {
+                sum += value;
+            }
+        }
+        DoNotOptimize(sum);
+    });
+}
+
+// Бенчмарки коротких списков: SmallSingleLinkedList без выделений памяти против SingleLinkedList
+void RunBenchmarkSmall(BenchmarkRunner& runner, size_t size) {
+    BenchmarkShortLists<SingleLinkedList<int>>(runner, "SingleLinkedList"s, size);
+    BenchmarkShortLists<SmallSingleLinkedList<int, 4u>>(runner, "SmallSingleLinkedList<int, 4>"s, size);
+}
+
+// Бенчмарк раздачи снимка списка читателям: каждый из readers читателей копирует снимок из size
+// элементов и добавляет в начало своей копии 8 элементов
+template <typename List>
+void BenchmarkSnapshotReaders(BenchmarkRunner& runner, const string& name, size_t size) {
+    List snapshot;
+    for (size_t i = 0u; i < size; ++i) {
+        snapshot.PushFront(static_cast<int>(i));
+    }
+    const size_t readers = 64u;
+    runner.Run(name + " copy + 8 x PushFront per reader"s, "int"s, size, readers, [&snapshot, readers] {
+        for (size_t reader = 0u; reader < readers; ++reader) {
+            List own(snapshot);
+            for (int i = 0; i < 8; ++i) {
+                own.PushFront(i);
+            }
+            DoNotOptimize(own.front());
+        }
+    });
+}
+
+// Бенчмарки персистентного списка в сравнении с глубоким копированием SingleLinkedList
+void RunBenchmarkPersistent(BenchmarkRunner& runner, size_t size) {
+    BenchmarkSnapshotReaders<SingleLinkedList<int>>(runner, "SingleLinkedList"s, size);
+    BenchmarkSnapshotReaders<PersistentSingleLinkedList<int>>(runner, "PersistentSingleLinkedList"s, size);
+}
+
+// Бенчмарки хеш-таблицы HashMap в сравнении с std::unordered_map на size ключах в случайном порядке:
+// вставка, поиск, полный обход, удаление и одна вставка, на которой таблица увеличивает число корзин
+void RunBenchmarkHashMap(BenchmarkRunner& runner, size_t size) {
+    vector<int> keys = MakeValues<int>(size);
+    shuffle(keys.begin(), keys.end(), mt19937(42));
+
+    const auto benchmark_map = [&runner, &keys, size](const string& name, auto map, auto needs_growth) {
+        runner.Run(name + " insert"s, "int"s, size, size, [&map, &keys] {
+            for (int key : keys) map[key] = key;
+        });
+        runner.Run(name + " find"s, "int"s, size, size, [&map, &keys] {
+            long long sum = 0;
+            for (int key : keys) sum += map.find(key)->second;
+            DoNotOptimize(sum);
+        });
+        runner.Run(name + " iteration"s, "int"s, size, size, [&map] {
+            long long sum = 0;
+            for (const auto& [key, value] : map) sum += value;
+            DoNotOptimize(sum);
+        });
+        runner.Run(name + " erase"s, "int"s, size, size, [&map, &keys] {
+            for (int key : keys) map.erase(key);
+        });
+
+        // Заполнение до порога роста и вставка, на которой таблица увеличивает число корзин
+        int key = 0;
+        while (!needs_growth(map)) {
+            map[key++] = 0;
+        }
+        runner.Run(name + " insert that grows the table"s, "int"s, map.size(), 1u, [&map, key] { map[key] = 0; });
+    };
+
+    // Обёртка HashMap с интерфейсом std::unordered_map для общего бенчмарка
+    struct HashMapAdapter : HashMap<int, int> {
+        auto find(int key) { return Find(key); }
+        void erase(int key) { Erase(key); }
+        size_t size() const { return GetSize(); }
+    };
+    benchmark_map("HashMap"s, HashMapAdapter(), [](const HashMapAdapter& map) {
+        return !map.IsRehashing() && static_cast<double>(map.GetSize() + 1u) > static_cast<double>(map.GetBucketCount());
+    });
+    benchmark_map("std::unordered_map"s, unordered_map<int, int>(), [](const unordered_map<int, int>& map) {
+        return static_cast<double>(map.size() + 1u) > map.max_load_factor() * static_cast<double>(map.bucket_count());
+    });
+}
+
+// Элемент интрузивного списка для бенчмарков
+struct IntrusivePoint : IntrusiveListHook<> {
+    Point point;
+};
+
+// Бенчмарки интрузивного списка: связывание уже существующих объектов без выделений памяти
+// в сравнении с SingleLinkedList, копирующим элементы в выделяемые узлы
+void RunBenchmarkIntrusive(BenchmarkRunner& runner, size_t size) {
+    const vector<Point> values = MakeValues<Point>(size);
+    runner.Run("SingleLinkedList PushBack + Clear"s, "Point"s, size, size, [&values] {
+        SingleLinkedList<Point> lst;
+        for (const Point& value : values) {
+            lst.PushBack(value);
+        }
+        DoNotOptimize(lst.back());
+    });
+
+    vector<IntrusivePoint> objects(size);
+    for (size_t i = 0u; i < size; ++i) {
+        objects[i].point = values[i];
+    }
+    runner.Run("IntrusiveSingleLinkedList PushBack + Clear"s, "Point"s, size, size, [&objects] {
+        IntrusiveSingleLinkedList<IntrusivePoint> lst;
+        for (IntrusivePoint& object : objects) {
+            lst.PushBack(object);
+        }
+        DoNotOptimize(lst.back().point);
+    });
+
+    // Объект поочерёдно переносится из середины списка в первую четверть и обратно
+    IntrusiveSingleLinkedList<IntrusivePoint> lst(objects.begin(), objects.end());
+    const auto quarter = std::next(lst.before_begin(), static_cast<std::ptrdiff_t>(size / 4u));
+    const auto middle = std::next(lst.before_begin(), static_cast<std::ptrdiff_t>(size / 2u));
+    runner.Run("IntrusiveSingleLinkedList EraseAfter + InsertAfter"s, "Point"s, size, size, [&lst, quarter, middle, size] {
+        for (size_t i = 0u; i < size; ++i) {
+            const auto from = i % 2u == 0u ? middle : quarter;
+            const auto to = i % 2u == 0u ? quarter : middle;
+            IntrusivePoint& object = *std::next(from);
+            lst.EraseAfter(from);
+            lst.InsertAfter(to, object);
+            DoNotOptimize(object.point);
+        }
+    });
+    lst.Clear();
+}
+
+// Функция создания списка из size случайных чисел из диапазона [0; max_value]
+SingleLinkedList<int> MakeRandomList(size_t size, int max_value) {
+    mt19937 generator(42);
+    uniform_int_distribution<int> distribution(0, max_value);
+    SingleLinkedList<int> lst;
+    for (size_t i = 0u; i < size; ++i) {
+        lst.PushBack(distribution(generator));
+    }
+    return lst;
+}
+
+// Функция обработки списка через вектор: копирование в вектор, обработка и пересборка списка
+template <typename VectorAlgorithm>
+void ViaVector(SingleLinkedList<int>& lst, VectorAlgorithm algorithm) {
+    vector<int> values(lst.begin(), lst.end());
+    algorithm(values);
+    SingleLinkedList<int> rebuilt;
+    for (int value : values) {
+        rebuilt.PushBack(value);
+    }
+    lst.swap(rebuilt);
+}
+
+// Бенчмарк алгоритма над списком: перецеплением узлов (list_algorithm) и через вектор (vector_algorithm)
+template <typename ListAlgorithm, typename VectorAlgorithm>
+void BenchmarkAlgorithm(BenchmarkRunner& runner, const string& name, size_t size, int max_value,
+                        ListAlgorithm list_algorithm, VectorAlgorithm vector_algorithm) {
+    SingleLinkedList<int> relinked = MakeRandomList(size, max_value);
+    runner.Run(name + " (relink)"s, "int"s, size, size, [&relinked, &list_algorithm] { list_algorithm(relinked); });
+
+    SingleLinkedList<int> copied = MakeRandomList(size, max_value);
+    runner.Run(name + " (copy to vector)"s, "int"s, size, size, [&copied, &vector_algorithm] { ViaVector(copied, vector_algorithm); });
+
+    if (relinked != copied) {
+        cerr << name << ": results differ"s << endl;
+        abort();
+    }
+}
+
+// Бенчмарки Sort, Unique, Reverse и RemoveIf в сравнении с обработкой через вектор
+void RunBenchmarkAlgorithms(BenchmarkRunner& runner, size_t size) {
+    const int max_value = static_cast<int>(size);
+    BenchmarkAlgorithm(runner, "SingleLinkedList::Sort"s, size, max_value,
+        [](SingleLinkedList<int>& lst) { lst.Sort(); },
+        [](vector<int>& values) { stable_sort(values.begin(), values.end()); });
+    BenchmarkAlgorithm(runner, "SingleLinkedList::Unique"s, size, 3,
+        [](SingleLinkedList<int>& lst) { lst.Unique(); },
+        [](vector<int>& values) { values.erase(unique(values.begin(), values.end()), values.end()); });
+    BenchmarkAlgorithm(runner, "SingleLinkedList::Reverse"s, size, max_value,
+        [](SingleLinkedList<int>& lst) { lst.Reverse(); },
+        [](vector<int>& values) { reverse(values.begin(), values.end()); });
+    BenchmarkAlgorithm(runner, "SingleLinkedList::RemoveIf"s, size, max_value,
+        [](SingleLinkedList<int>& lst) { lst.RemoveIf([](int value) { return value % 2 == 0; }); },
+        [](vector<int>& values) { values.erase(remove_if(values.begin(), values.end(), [](int value) { return value % 2 == 0; }), values.end()); });
+}
+
+// Функция запуска функции worker(thread_index) в threads потоках
+template <typename Worker>
+void RunThreads(size_t threads, Worker worker) {
+    vector<thread> workers;
+    for (size_t t = 0u; t < threads; ++t) {
+        workers.emplace_back(worker, t);
+    }
+    for (thread& w : workers) {
+        w.join();
+    }
+}
+
+// Бенчмарк пар PushFront/PopFront из нескольких потоков: список без блокировок против SingleLinkedList с мьютексом
+void RunBenchmarkConcurrent(BenchmarkRunner& runner, size_t ops_per_thread) {
+    const size_t max_threads = max<size_t>(thread::hardware_concurrency(), 8u);
+    for (size_t threads = 1u; threads <= max_threads; threads *= 2u) {
+        const size_t ops = threads * ops_per_thread;
+        const string suffix = ", threads = "s + to_string(threads);
+
+        ConcurrentSingleLinkedList<int> lock_free;
+        runner.Run("ConcurrentSingleLinkedList push/pop"s + suffix, "int"s, 0u, ops, [&] { RunThreads(threads, [&lock_free, ops_per_thread](size_t t) {
+            for (size_t i = 0u; i < ops_per_thread; ++i) {
+                lock_free.PushFront(static_cast<int>(t + i));
+                DoNotOptimize(lock_free.PopFront());
+            }
+        }); });
+
+        SingleLinkedList<int> locked;
+        mutex locked_mutex;
+        runner.Run("SingleLinkedList + mutex push/pop"s + suffix, "int"s, 0u, ops, [&] { RunThreads(threads, [&locked, &locked_mutex, ops_per_thread](size_t t) {
+            for (size_t i = 0u; i < ops_per_thread; ++i) {
+                {
+                    lock_guard guard(locked_mutex);
+                    locked.PushFront(static_cast<int>(t + i));
+                }
+                lock_guard guard(locked_mutex);
+                if (!locked.IsEmpty()) {
+                    DoNotOptimize(locked.front());
+                    locked.PopFront();
+                }
+            }
+        }); });
+    }
+}
+
+// Бенчмарки двоичной сериализации в сравнении с текстовым operator <<
+template <typename Type>
+void BenchmarkSerialization(BenchmarkRunner& runner, size_t size) {
+    const string type = ValueTraits<Type>::Name();
+    const auto lst = MakeList<SingleLinkedList<Type>>(MakeValues<Type>(size));
+
+    runner.Run("operator << (text)"s, type, size, size, [&lst] {
+        ostringstream os;
+        os << lst;
+        DoNotOptimize(os.tellp());
+    });
+
+    stringstream binary;
+    runner.Run("WriteBinary"s, type, size, size, [&lst, &binary] { WriteBinary(binary, lst); });
+    runner.Run("ReadBinary"s, type, size, size, [&binary] {
+        SingleLinkedList<Type> restored;
+        ReadBinary(binary, restored);
+        DoNotOptimize(restored.GetSize());
+    });
+}
+
+void RunBenchmarkSerialization(BenchmarkRunner& runner, size_t size) {
+    BenchmarkSerialization<int>(runner, size);
+    BenchmarkSerialization<string>(runner, size);
+}
+
+// Очередь на SingleLinkedList под мьютексом (PushBack/PopFront) - то, что заменяет MpscQueue
+class LockedListQueue {
+public:
+    void Push(int value) {
+        lock_guard guard(mutex_);
+        list_.PushBack(value);
+    }
+
+    // Потребитель забирает элементы по одному, как из обычной очереди
+    size_t PopAll() {
+        size_t count = 0u;
+        lock_guard guard(mutex_);
+        for (; !list_.IsEmpty(); ++count) {
+            DoNotOptimize(list_.front());
+            list_.PopFront();
+        }
+        return count;
+    }
+
+private:
+    mutex mutex_;
+    SingleLinkedList<int> list_;
+};
+
+// Пропускная способность очереди: producers потоков добавляют по ops_per_producer элементов,
+// потребитель (вызывающий поток) забирает их функцией drain, возвращающей количество забранных элементов
+template <typename Push, typename Drain>
+void RunProducersAndConsumer(size_t producers, size_t ops_per_producer, Push push, Drain drain) {
+    vector<thread> workers;
+    for (size_t p = 0u; p < producers; ++p) {
+        workers.emplace_back([&push, ops_per_producer, p] {
+            for (size_t i = 0u; i < ops_per_producer; ++i) {
+                push(static_cast<int>(p + i));
+            }
+        });
+    }
+    for (size_t received = 0u; received < producers * ops_per_producer;) {
+        const size_t count = drain();
+        if (count == 0u) this_thread::yield();
+        received += count;
+    }
+    for (thread& worker : workers) {
+        worker.join();
+    }
+}
+
+// Бенчмарки очереди MpscQueue в сравнении с SingleLinkedList под мьютексом: пропускная способность
+// (без ограничения и с ограничением размера очереди) и задержка доставки одного элемента потребителю
+void RunBenchmarkMpscQueue(BenchmarkRunner& runner, size_t ops_per_producer) {
+    const size_t max_producers = max<size_t>(thread::hardware_concurrency(), 4u);
+    for (size_t producers = 1u; producers <= max_producers; producers *= 2u) {
+        const size_t ops = producers * ops_per_producer;
+        const string suffix = ", producers = "s + to_string(producers);
+
+        runner.Run("MpscQueue throughput"s + suffix, "int"s, 0u, ops, [producers, ops_per_producer] {
+            MpscQueue<int> queue;
+            RunProducersAndConsumer(producers, ops_per_producer, [&queue](int value) { queue.Push(value); },
+                                    [&queue] { return queue.Drain().GetSize(); });
+        });
+        runner.Run("MpscQueue throughput (capacity 1024)"s + suffix, "int"s, 0u, ops, [producers, ops_per_producer] {
+            MpscQueue<int> queue(1024u);
+            RunProducersAndConsumer(producers, ops_per_producer, [&queue](int value) { queue.Push(value); },
+                                    [&queue] { return queue.Drain().GetSize(); });
+        });
+        runner.Run("SingleLinkedList + mutex queue throughput"s + suffix, "int"s, 0u, ops, [producers, ops_per_producer] {
+            LockedListQueue queue;
+            RunProducersAndConsumer(producers, ops_per_producer, [&queue](int value) { queue.Push(value); },
+                                    [&queue] { return queue.PopAll(); });
+        });
+    }
+
+    // Задержка: производитель добавляет элемент и ждёт, пока потребитель его не заберёт
+    const size_t round_trips = max<size_t>(ops_per_producer / 100u, 1u);
+    const auto measure_latency = [round_trips](auto& queue, auto drain) {
+        atomic<size_t> delivered{ 0u };
+        thread consumer([&] {
+            for (size_t received = 0u; received < round_trips;) {
+                const size_t count = drain(queue);
+                if (count == 0u) this_thread::yield();
+                received += count;
+                delivered.store(received, memory_order_release);
+            }
+        });
+        for (size_t i = 0u; i < round_trips; ++i) {
+            queue.Push(static_cast<int>(i));
+            while (delivered.load(memory_order_acquire) <= i) this_thread::yield();
+        }
+        consumer.join();
+    };
+    runner.Run("MpscQueue push-to-drain latency"s, "int"s, 0u, round_trips, [&measure_latency] {
+        MpscQueue<int> queue;
+        measure_latency(queue, [](MpscQueue<int>& q) { return q.Drain().GetSize(); });
+    });
+    runner.Run("SingleLinkedList + mutex queue push-to-pop latency"s, "int"s, 0u, round_trips, [&measure_latency] {
+        LockedListQueue queue;
+        measure_latency(queue, [](LockedListQueue& q) { return q.PopAll(); });
+    });
+}
+
+// "Дорогая" функция элемента для бенчмарков параллельных алгоритмов
+double HeavyFunction(double value) {
+    for (int i = 0; i < 32; ++i) {
+        value = std::sqrt(value + 1.0);
+    }
+    return value;
+}
+
+// Бенчмарки параллельных алгоритмов: последовательный проход против ParallelReduce/ParallelForEach
+// на разном количестве потоков, с разбиением списка при каждом вызове и с готовым разбиением
+void RunBenchmarkParallel(BenchmarkRunner& runner, size_t size) {
+    SingleLinkedList<double> lst;
+    for (size_t i = 0u; i < size; ++i) {
+        lst.PushBack(static_cast<double>(i));
+    }
+
+    runner.Run("sequential sum"s, "double"s, size, size, [&lst] { DoNotOptimize(accumulate(lst.begin(), lst.end(), 0.0)); });
+    runner.Run("sequential heavy for_each"s, "double"s, size, size, [&lst] {
+        for (double& value : lst) value = HeavyFunction(value);
+    });
+
+    const size_t max_threads = max<size_t>(thread::hardware_concurrency(), 4u);
+    for (size_t threads = 1u; threads <= max_threads; threads *= 2u) {
+        const string suffix = ", threads = "s + to_string(threads);
+        ThreadPool pool(threads);
+        runner.Run("ParallelReduce sum"s + suffix, "double"s, size, size, [&pool, &lst] {
+            DoNotOptimize(ParallelReduce(pool, lst, 0.0));
+        });
+
+        const ListSegments<SingleLinkedList<double>> segments(lst);
+        runner.Run("ParallelReduce sum (ready segments)"s + suffix, "double"s, size, size, [&pool, &segments] {
+            DoNotOptimize(ParallelReduce(pool, segments, 0.0));
+        });
+        runner.Run("ParallelForEach heavy"s + suffix, "double"s, size, size, [&pool, &segments] {
+            ParallelForEach(pool, segments, [](double& value) { value = HeavyFunction(value); });
+        });
+    }
+}
+
+}
+
+// Функция разбора списка размеров через запятую
+vector<size_t> ParseSizes(const string& text) {
+    vector<size_t> sizes;
+    size_t pos = 0u;
+    while (pos < text.size()) {
+        size_t comma = text.find(',', pos);
+        if (comma == string::npos) comma = text.size();
+        sizes.push_back(static_cast<size_t>(stoull(text.substr(pos, comma - pos))));
+        pos = comma + 1u;
+    }
+    return sizes;
+}
+
+int main(int argc, char* argv[]) {
+    vector<size_t> sizes;
+    string filter;
+    string json_path;
+    string csv_path;
+    for (int i = 1; i < argc; ++i) {
+        const string arg = argv[i];
+        if (arg.rfind("--sizes="s, 0) == 0) {
+            const vector<size_t> parsed = ParseSizes(arg.substr(8));
+            sizes.insert(sizes.end(), parsed.begin(), parsed.end());
+        } else if (arg.rfind("--filter="s, 0) == 0) {
+            filter = arg.substr(9);
+        } else if (arg.rfind("--json="s, 0) == 0) {
+            json_path = arg.substr(7);
+        } else if (arg.rfind("--csv="s, 0) == 0) {
+            csv_path = arg.substr(6);
+        } else {
+            sizes.push_back(static_cast<size_t>(stoull(arg)));
+        }
+    }
+    if (sizes.empty()) {
+        sizes = { 1'000u, 100'000u, 1'000'000u };
+    }
+
+    benchmarks::BenchmarkRunner runner(filter);
+    for (size_t size : sizes) {
+        benchmarks::RunBenchmarkListOperations(runner, size);
+        benchmarks::RunBenchmarkScan(runner, size);
+        benchmarks::RunBenchmarkCompact(runner, size);
+        benchmarks::RunBenchmarkSmall(runner, size);
+        benchmarks::RunBenchmarkPersistent(runner, size);
+        benchmarks::RunBenchmarkHashMap(runner, size);
+        benchmarks::RunBenchmarkIntrusive(runner, size);
+        benchmarks::RunBenchmarkIndexed(runner, size);
+        benchmarks::RunBenchmarkShuffledTraversal(runner, size);
+        benchmarks::RunBenchmarkPoolCopy(runner, size);
+        benchmarks::RunBenchmarkAlgorithms(runner, size);
+        benchmarks::RunBenchmarkConcurrent(runner, size / 10u);
+        benchmarks::RunBenchmarkMpscQueue(runner, size / 10u);
+        benchmarks::RunBenchmarkParallel(runner, size);
+        benchmarks::RunBenchmarkSerialization(runner, size);
+    }
+
+    if (!json_path.empty()) {
+        ofstream json(json_path);
+        runner.WriteJson(json);
+    }
+    if (!csv_path.empty()) {
+        ofstream csv(csv_path);
+        runner.WriteCsv(csv);
+    }
+
+    return 0;
+}
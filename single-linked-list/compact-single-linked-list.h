@@ -0,0 +1,414 @@
+#pragma once
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// Класс компактного односвязного списка: узлы лежат в одном непрерывном массиве и связаны 32-битными
+// индексами вместо указателей. Для SingleLinkedList<int> узел занимает 16 байт (8 байт указателя,
+// 4 байта значения и выравнивание), здесь - 8 байт. Освобождённые узлы переиспользуются через
+// список свободных индексов. Интерфейс повторяет SingleLinkedList.
+// Итераторы хранят индекс узла и остаются действительными при росте массива, а ссылки и указатели
+// на элементы при росте массива (добавлении элементов) становятся недействительными
+template <typename Type>
+class CompactSingleLinkedList {
+    static_assert(std::is_nothrow_move_constructible_v<Type>, "Elements are moved when the node array grows and must not throw on move");
+
+private:
+    // Индекс "нет узла" и индекс фиктивного узла (он хранится вне массива)
+    static constexpr uint32_t kNoNode = std::numeric_limits<uint32_t>::max();
+    static constexpr uint32_t kBeforeBegin = kNoNode - 1u;
+
+    // Узел списка: индекс следующего узла и место под значение
+    struct Slot {
+        uint32_t next_node = kNoNode;
+        alignas(Type) std::byte storage[sizeof(Type)];
+
+        Type& Value() noexcept { return *std::launder(reinterpret_cast<Type*>(storage)); }
+    };
+
+    // Класс итератора/константного итератора (ValueType=Type/const Type) списка
+    template <typename ValueType>
+    class BasicIterator {
+        // Предоставим классу списка доступ к приватным полям и методам
+        friend class CompactSingleLinkedList;
+
+        using ListPointer = std::conditional_t<std::is_const_v<ValueType>, const CompactSingleLinkedList*, CompactSingleLinkedList*>;
+
+    public:
+        // Описание типа итератора
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = ValueType*;
+        using reference = ValueType&;
+
+        // Конструктор по умолчанию
+        BasicIterator() = default;
+
+        // Конструктор копирования
+        BasicIterator(const BasicIterator<Type>& other) noexcept : list_(other.list_), index_(other.index_) { }
+
+        // Оператор присваивания
+        BasicIterator& operator = (const BasicIterator& rhs) = default;
+
+        // Операторы сравнения неконстантных итераторов (ValueType = Type)
+        [[nodiscard]] bool operator == (const BasicIterator<Type>& rhs) const noexcept { return index_ == rhs.index_; }
+        [[nodiscard]] bool operator != (const BasicIterator<Type>& rhs) const noexcept { return !(*this == rhs); }
+
+        // Операторы сравнения константных итераторов (ValueType = const Type)
+        [[nodiscard]] bool operator == (const BasicIterator<const Type>& rhs) const noexcept { return index_ == rhs.index_; }
+        [[nodiscard]] bool operator != (const BasicIterator<const Type>& rhs) const noexcept { return !(*this == rhs); }
+
+        // Преинкремент
+        BasicIterator& operator ++ () noexcept {
+            assert(index_ != kNoNode);
+            index_ = list_->NextOf(index_);
+            return *this;
+        }
+
+        // Постинкремент
+        BasicIterator operator ++ (int) noexcept {
+            BasicIterator tmp(*this);
+            ++(*this);
+            return tmp;
+        }
+
+        // Оператор разыменовывания
+        [[nodiscard]] reference operator * () const noexcept {
+            assert(index_ < list_->bump_);
+            return list_->slots_[index_].Value();
+        }
+
+        // Оператор доступа к членам
+        [[nodiscard]] pointer operator -> () const noexcept {
+            return &(**this);
+        }
+
+    private:
+        ListPointer list_ = nullptr;  // Список, которому принадлежит узел
+        uint32_t index_ = kNoNode;    // Индекс узла
+
+        // Конструктор, создающий итератор из индекса узла (используется в классе списка)
+        BasicIterator(ListPointer list, uint32_t index) noexcept : list_(list), index_(index) { }
+
+        template <typename> friend class BasicIterator;
+    };
+
+public:
+    // Псевдонимы для типов, ссылок, константных ссылок, итераторов и константных итераторов
+    using value_type = Type;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+    using Iterator      = BasicIterator<Type>;
+    using ConstIterator = BasicIterator<const Type>;
+
+    // Максимальный размер списка
+    static constexpr size_t max_size = kBeforeBegin;
+
+    // Конструктор по умолчанию создаёт пустой список
+    CompactSingleLinkedList() noexcept = default;
+
+    // Конструктор, создающий список из элементов std::initializer_list
+    CompactSingleLinkedList(std::initializer_list<Type> values) {
+        CopyAndSwapFromIteratorRage(values.begin(), values.end(), values.size());
+    }
+
+    // Конструктор копирования. Узлы копии идут в массиве подряд, в порядке списка
+    CompactSingleLinkedList(const CompactSingleLinkedList& other) {
+        CopyAndSwapFromIteratorRage(other.begin(), other.end(), other.GetSize());
+    }
+
+    // Конструктор перемещения
+    CompactSingleLinkedList(CompactSingleLinkedList&& other) noexcept { swap(other); }
+
+    // Деструктор
+    ~CompactSingleLinkedList() noexcept {
+        Clear();
+        std::allocator<Slot>().deallocate(slots_, capacity_);
+    }
+
+    // Оператор присваивания
+    CompactSingleLinkedList& operator = (const CompactSingleLinkedList& rhs) {
+        if (this != &rhs) {
+            CompactSingleLinkedList rhs_copy(rhs);
+            this->swap(rhs_copy);
+        }
+        return *this;
+    }
+
+    // Оператор перемещающего присваивания
+    CompactSingleLinkedList& operator = (CompactSingleLinkedList&& rhs) noexcept {
+        if (this != &rhs) {
+            CompactSingleLinkedList tmp(std::move(rhs));
+            this->swap(tmp);
+        }
+        return *this;
+    }
+
+    // Итераторы, указывающие на начало, конец и фиктивный узел списка
+    [[nodiscard]] Iterator begin()        noexcept { return Iterator(this, head_); }
+    [[nodiscard]] Iterator end()          noexcept { return Iterator(this, kNoNode); }
+    [[nodiscard]] Iterator before_begin() noexcept { return Iterator(this, kBeforeBegin); }
+
+    // Итератор, указывающий на последний элемент списка (на фиктивный узел, если список пуст)
+    [[nodiscard]] Iterator      before_end()        noexcept { return Iterator(this, tail_); }
+    [[nodiscard]] ConstIterator before_end()  const noexcept { return cbefore_end(); }
+    [[nodiscard]] ConstIterator cbefore_end() const noexcept { return ConstIterator(this, tail_); }
+
+    // Константные итераторы, указывающие на начало, конец и фиктивный узел списка
+    [[nodiscard]] ConstIterator begin()        const noexcept { return cbegin(); }
+    [[nodiscard]] ConstIterator end()          const noexcept { return cend(); }
+    [[nodiscard]] ConstIterator before_begin() const noexcept { return cbefore_begin(); }
+
+    [[nodiscard]] ConstIterator cbegin()        const noexcept { return ConstIterator(this, head_); }
+    [[nodiscard]] ConstIterator cend()          const noexcept { return ConstIterator(this, kNoNode); }
+    [[nodiscard]] ConstIterator cbefore_begin() const noexcept { return ConstIterator(this, kBeforeBegin); }
+
+    // Функция обмена с другим списком. Итераторы хранят указатель на список, поэтому в отличие от
+    // SingleLinkedList после обмена (и перемещения) итераторы обоих списков становятся недействительными
+    void swap(CompactSingleLinkedList& other) noexcept {
+        std::swap(slots_, other.slots_);
+        std::swap(capacity_, other.capacity_);
+        std::swap(bump_, other.bump_);
+        std::swap(free_, other.free_);
+        std::swap(head_, other.head_);
+        std::swap(tail_, other.tail_);
+        std::swap(size_, other.size_);
+    }
+
+    // Функция получения размера
+    [[nodiscard]] size_t GetSize() const noexcept { return size_; }
+
+    // Функция проверки на пустоту
+    [[nodiscard]] bool IsEmpty() const noexcept { return size_ == 0u; }
+
+    // Функция получения количества узлов, под которые выделена память
+    [[nodiscard]] size_t GetCapacity() const noexcept { return capacity_; }
+
+    // Функция резервирования памяти под capacity узлов
+    void Reserve(size_t capacity) {
+        if (capacity > capacity_) {
+            Reallocate(capacity);
+        }
+    }
+
+    // Функции доступа к первому и последнему элементам списка
+    [[nodiscard]] reference       front()       noexcept { assert(!IsEmpty()); return slots_[head_].Value(); }
+    [[nodiscard]] const_reference front() const noexcept { assert(!IsEmpty()); return slots_[head_].Value(); }
+    [[nodiscard]] reference       back()        noexcept { assert(!IsEmpty()); return slots_[tail_].Value(); }
+    [[nodiscard]] const_reference back()  const noexcept { assert(!IsEmpty()); return slots_[tail_].Value(); }
+
+    // Функция добавления в начало списка
+    void PushFront(const Type& value) { EmplaceAfter(cbefore_begin(), value); }
+    void PushFront(Type&& value) { EmplaceAfter(cbefore_begin(), std::move(value)); }
+
+    // Функция создания элемента в начале списка из аргументов конструктора Type
+    template <typename... Args>
+    reference EmplaceFront(Args&&... args) { return *EmplaceAfter(cbefore_begin(), std::forward<Args>(args)...); }
+
+    // Функция удаления из начала списка
+    void PopFront() noexcept {
+        assert(!IsEmpty());
+        EraseAfter(cbefore_begin());
+    }
+
+    // Функция добавления в конец списка за O(1)
+    void PushBack(const Type& value) { EmplaceAfter(cbefore_end(), value); }
+    void PushBack(Type&& value) { EmplaceAfter(cbefore_end(), std::move(value)); }
+
+    // Функция создания элемента в конце списка из аргументов конструктора Type
+    template <typename... Args>
+    reference EmplaceBack(Args&&... args) { return *EmplaceAfter(cbefore_end(), std::forward<Args>(args)...); }
+
+    // Функция добавления после элемента, на который указывает итератор
+    Iterator InsertAfter(ConstIterator pos, const Type& value) { return EmplaceAfter(pos, value); }
+    Iterator InsertAfter(ConstIterator pos, Type&& value) { return EmplaceAfter(pos, std::move(value)); }
+
+    // Функция создания элемента после элемента, на который указывает итератор, из аргументов конструктора Type.
+    // Если массив узлов заполнен, элемент сначала создаётся вне списка (аргументы могут ссылаться на элементы
+    // списка, которые переместятся при росте массива). При исключении список не меняется
+    template <typename... Args>
+    Iterator EmplaceAfter(ConstIterator pos, Args&&... args) {
+        assert(pos.list_ == this && pos.index_ != kNoNode);
+
+        uint32_t index = kNoNode;
+        if (free_ != kNoNode) {
+            index = free_;
+            ::new (slots_[index].storage) Type(std::forward<Args>(args)...);
+            free_ = slots_[index].next_node;
+        } else if (bump_ < capacity_) {
+            index = bump_;
+            ::new (slots_[index].storage) Type(std::forward<Args>(args)...);
+            ++bump_;
+        } else {
+            Type value(std::forward<Args>(args)...);
+            Reallocate(NextCapacity());
+            index = bump_;
+            ::new (slots_[index].storage) Type(std::move(value));
+            ++bump_;
+        }
+
+        uint32_t& link = LinkOf(pos.index_);
+        slots_[index].next_node = link;
+        link = index;
+        if (pos.index_ == tail_) tail_ = index;
+        ++size_;
+        return Iterator(this, index);
+    }
+
+    // Функция удаления после элемента, на который указывает итератор
+    Iterator EraseAfter(ConstIterator pos) noexcept {
+        assert(pos.list_ == this && pos.index_ != kNoNode);
+
+        uint32_t& link = LinkOf(pos.index_);
+        const uint32_t index = link;
+        assert(index != kNoNode);
+
+        Slot& slot = slots_[index];
+        link = slot.next_node;
+        if (index == tail_) tail_ = pos.index_;
+        slot.Value().~Type();
+        slot.next_node = free_;
+        free_ = index;
+        --size_;
+
+        return Iterator(this, link);
+    }
+
+    // Функция удаления из конца списка за O(n) (как и в SingleLinkedList)
+    void PopBack() noexcept {
+        assert(!IsEmpty());
+
+        uint32_t pre_back = kBeforeBegin;
+        while (NextOf(pre_back) != tail_) { pre_back = NextOf(pre_back); }
+        EraseAfter(ConstIterator(this, pre_back));
+    }
+
+    // Очистка списка. Память узлов остаётся за списком
+    void Clear() noexcept {
+        if constexpr (!std::is_trivially_destructible_v<Type>) {
+            for (uint32_t index = head_; index != kNoNode; index = slots_[index].next_node) {
+                slots_[index].Value().~Type();
+            }
+        }
+
+        bump_ = 0u;
+        free_ = kNoNode;
+        head_ = kNoNode;
+        tail_ = kBeforeBegin;
+        size_ = 0u;
+    }
+
+private:
+    Slot* slots_ = nullptr;       // Массив узлов
+    uint32_t capacity_ = 0u;      // Количество узлов в массиве
+    uint32_t bump_ = 0u;          // Индекс первого ни разу не использованного узла
+    uint32_t free_ = kNoNode;     // Список свободных узлов (связан через next_node)
+    uint32_t head_ = kNoNode;     // Связь фиктивного узла: индекс первого узла
+    uint32_t tail_ = kBeforeBegin; // Последний узел (фиктивный, если список пуст)
+    size_t size_ = 0u;            // Размер списка
+
+    // Функции получения связи узла (и фиктивного узла)
+    uint32_t& LinkOf(uint32_t index) noexcept { return index == kBeforeBegin ? head_ : slots_[index].next_node; }
+    uint32_t NextOf(uint32_t index) const noexcept { return index == kBeforeBegin ? head_ : slots_[index].next_node; }
+
+    // Функция вычисления ёмкости массива для роста
+    uint32_t NextCapacity() const {
+        if (capacity_ == max_size) {
+            throw std::length_error("CompactSingleLinkedList is too long");
+        }
+        return static_cast<uint32_t>(std::min<size_t>(std::max<size_t>(16u, size_t{ capacity_ } * 2u), max_size));
+    }
+
+    // Функция перевыделения массива узлов. Элементы перемещаются на те же индексы, связи копируются
+    void Reallocate(size_t capacity) {
+        if (capacity > max_size) {
+            throw std::length_error("CompactSingleLinkedList is too long");
+        }
+        Slot* slots = std::allocator<Slot>().allocate(capacity);
+        for (size_t index = 0u; index < capacity; ++index) {
+            ::new (&slots[index]) Slot;
+        }
+        for (uint32_t index = 0u; index < bump_; ++index) {
+            slots[index].next_node = slots_[index].next_node;
+        }
+        for (uint32_t index = head_; index != kNoNode; index = slots_[index].next_node) {
+            ::new (slots[index].storage) Type(std::move(slots_[index].Value()));
+            slots_[index].Value().~Type();
+        }
+
+        std::allocator<Slot>().deallocate(slots_, capacity_);
+        slots_ = slots;
+        capacity_ = static_cast<uint32_t>(capacity);
+    }
+
+    // Функция для реализации идеомы copy-and-swap в конструкторе: создаёт список, инициализированный
+    // элементами в интервале [begin; end) и меняет его местами с текущим
+    template <typename ContainerIterator>
+    void CopyAndSwapFromIteratorRage(const ContainerIterator begin, const ContainerIterator end, size_t size) {
+        CompactSingleLinkedList tmp;
+        tmp.Reserve(size);
+
+        for (ContainerIterator it = begin; it != end; ++it) {
+            tmp.EmplaceAfter(tmp.cbefore_end(), *it);
+        }
+
+        this->swap(tmp);
+    }
+};
+
+// Функция обмена формата swap(lhs, rhs)
+template <typename Type>
+void swap(CompactSingleLinkedList<Type>& lhs, CompactSingleLinkedList<Type>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+// Оператор сравнения списков "=="
+template <typename Type>
+bool operator == (const CompactSingleLinkedList<Type>& lhs, const CompactSingleLinkedList<Type>& rhs) {
+    return lhs.GetSize() == rhs.GetSize() && std::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin());
+}
+
+// Оператор сравнения списков "<"
+template <typename Type>
+bool operator < (const CompactSingleLinkedList<Type>& lhs, const CompactSingleLinkedList<Type>& rhs) {
+    return std::lexicographical_compare(lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend());
+}
+
+// Производные от "==" и "<" операторы сравнения списков
+template <typename Type>
+bool operator != (const CompactSingleLinkedList<Type>& lhs, const CompactSingleLinkedList<Type>& rhs) { return !(lhs == rhs); }
+
+template <typename Type>
+bool operator >  (const CompactSingleLinkedList<Type>& lhs, const CompactSingleLinkedList<Type>& rhs) { return rhs < lhs; }
+
+template <typename Type>
+bool operator <= (const CompactSingleLinkedList<Type>& lhs, const CompactSingleLinkedList<Type>& rhs) { return !(rhs < lhs); }
+
+template <typename Type>
+bool operator >= (const CompactSingleLinkedList<Type>& lhs, const CompactSingleLinkedList<Type>& rhs) { return !(lhs < rhs); }
+
+// Оператор "<<" для вывода содержимого списка в поток
+template <typename Type>
+std::ostream& operator << (std::ostream& os, const CompactSingleLinkedList<Type>& compact_list) {
+    using namespace std::literals;
+    os << "{"s;
+    bool first = true;
+    for (const Type& element : compact_list) {
+        if (!first) os << ", "s;
+        else        first = false;
+        os << element;
+    }
+    os << "}"s;
+    return os;
+}
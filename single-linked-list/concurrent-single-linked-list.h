@@ -0,0 +1,386 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <thread>
+#include <utility>
+
+// Класс потокобезопасного односвязного списка без блокировок (список Харриса-Майкла).
+// Удаление элемента идёт в два шага: сначала помечается связь удаляемого узла со следующим
+// (логическое удаление), затем узел вырезается из списка (физическое удаление). Вырезанные узлы
+// освобождаются через эпохи (epoch-based reclamation): узел удаляется, только когда все потоки,
+// которые могли его видеть, вышли из своих операций.
+// Итераторы действительны, пока жив объект Guard, полученный через Pin(). Элементы доступны только
+// для чтения: удаляемые функции возвращают копию значения, так как узел ещё могут читать другие потоки
+template <typename Type>
+class ConcurrentSingleLinkedList {
+private:
+    // Базовая структура узла списка: связь со следующим узлом. Младший бит связи - метка логического
+    // удаления узла, которому принадлежит связь
+    struct NodeBase {
+        std::atomic<std::uintptr_t> next_node{ 0u };
+    };
+
+    // Структура узла списка
+    struct Node : NodeBase {
+        template <typename... Args>
+        explicit Node(Args&&... args) : value(std::forward<Args>(args)...) { }
+
+        Type value;
+        std::atomic<bool> unlinked{ false }; // Узел вырезан из списка
+        Node* retired_next = nullptr; // Следующий узел в списке ожидающих освобождения
+        uint64_t retire_epoch = 0u;   // Эпоха, в которую узел был вырезан из списка
+    };
+
+    // Функции работы со связями с меткой удаления
+    static std::uintptr_t ToLink(NodeBase* node) noexcept { return reinterpret_cast<std::uintptr_t>(node); }
+    static Node* ToNode(std::uintptr_t link) noexcept { return reinterpret_cast<Node*>(link & ~std::uintptr_t{ 1u }); }
+    static bool IsMarked(std::uintptr_t link) noexcept { return (link & 1u) != 0u; }
+    static std::uintptr_t Marked(std::uintptr_t link) noexcept { return link | 1u; }
+
+    // Количество слотов для одновременно активных Guard
+    static constexpr size_t kGuardSlots = 128u;
+
+    // Количество вырезанных узлов в слоте, после которого слот пытается их освободить
+    static constexpr size_t kReclaimThreshold = 64u;
+
+    // Слот активной операции: эпоха, в которую операция началась (0 - слот не используется),
+    // и вырезанные узлы, ожидающие освобождения. Список вырезанных узлов трогает только владелец слота
+    struct alignas(64) Slot {
+        std::atomic<bool> in_use{ false };
+        std::atomic<uint64_t> epoch{ 0u };
+        Node* retired = nullptr;
+        size_t retired_count = 0u;
+        size_t reclaim_at = kReclaimThreshold; // Количество вырезанных узлов для следующей попытки освобождения
+    };
+
+public:
+    // Класс защиты от освобождения узлов: пока объект жив, узлы, видимые из текущего потока, не освобождаются
+    class Guard {
+        // Предоставим классу списка доступ к приватным полям и методам
+        friend class ConcurrentSingleLinkedList;
+
+    public:
+        Guard(const Guard&) = delete;
+        Guard& operator = (const Guard&) = delete;
+
+        Guard(Guard&& other) noexcept : list_(std::exchange(other.list_, nullptr)), slot_(other.slot_) { }
+
+        ~Guard() noexcept {
+            if (list_) {
+                list_->Unpin(*slot_);
+            }
+        }
+
+    private:
+        const ConcurrentSingleLinkedList* list_ = nullptr;
+        Slot* slot_ = nullptr;
+
+        Guard(const ConcurrentSingleLinkedList& list, Slot& slot) noexcept : list_(&list), slot_(&slot) { }
+    };
+
+    // Класс константного итератора списка. Пропускает логически удалённые узлы
+    class ConstIterator {
+        // Предоставим классу списка доступ к приватным полям и методам
+        friend class ConcurrentSingleLinkedList;
+
+    public:
+        // Описание типа итератора
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Type*;
+        using reference = const Type&;
+
+        // Конструктор по умолчанию
+        ConstIterator() = default;
+
+        // Операторы сравнения
+        [[nodiscard]] bool operator == (const ConstIterator& rhs) const noexcept { return node_ == rhs.node_; }
+        [[nodiscard]] bool operator != (const ConstIterator& rhs) const noexcept { return !(*this == rhs); }
+
+        // Преинкремент
+        ConstIterator& operator ++ () noexcept {
+            assert(node_);
+            node_ = SkipDeleted(ToNode(node_->next_node.load()));
+            return *this;
+        }
+
+        // Постинкремент
+        ConstIterator operator ++ (int) noexcept {
+            ConstIterator tmp(*this);
+            ++(*this);
+            return tmp;
+        }
+
+        // Оператор разыменовывания
+        [[nodiscard]] reference operator * () const noexcept {
+            assert(node_);
+            return static_cast<const Node*>(node_)->value;
+        }
+
+        // Оператор доступа к членам
+        [[nodiscard]] pointer operator -> () const noexcept {
+            assert(node_);
+            return &(static_cast<const Node*>(node_)->value);
+        }
+
+    private:
+        // Указатель на узел
+        NodeBase* node_ = nullptr;
+
+        // Конструктор, создающий итератор из указателя на узел (используется в классе списка)
+        explicit ConstIterator(NodeBase* node) noexcept : node_(node) { }
+
+        // Функция пропуска логически удалённых узлов
+        static Node* SkipDeleted(Node* node) noexcept {
+            while (node) {
+                const std::uintptr_t next = node->next_node.load();
+                if (!IsMarked(next)) {
+                    break;
+                }
+                node = ToNode(next);
+            }
+            return node;
+        }
+    };
+
+    // Псевдонимы для типов и итераторов
+    using value_type = Type;
+    using Iterator = ConstIterator;
+
+    // Конструктор по умолчанию создаёт пустой список
+    ConcurrentSingleLinkedList() noexcept = default;
+
+    ConcurrentSingleLinkedList(const ConcurrentSingleLinkedList&) = delete;
+    ConcurrentSingleLinkedList& operator = (const ConcurrentSingleLinkedList&) = delete;
+
+    // Деструктор. К моменту разрушения список не должен использоваться другими потоками
+    ~ConcurrentSingleLinkedList() noexcept {
+        Node* node = ToNode(head_.next_node.load());
+        while (node) {
+            Node* tmp = ToNode(node->next_node.load());
+            delete node;
+            node = tmp;
+        }
+        for (Slot& slot : slots_) {
+            FreeRetired(slot, std::numeric_limits<uint64_t>::max());
+        }
+    }
+
+    // Функция получения защиты от освобождения узлов. Итераторы списка действительны, пока жив Guard
+    [[nodiscard]] Guard Pin() const noexcept {
+        Slot& slot = AcquireSlot();
+        slot.epoch.store(epoch_.load());
+        return Guard(*this, slot);
+    }
+
+    // Итераторы, указывающие на начало, конец и фиктивный узел списка (требуют активного Guard)
+    [[nodiscard]] ConstIterator begin()        const noexcept { return cbegin(); }
+    [[nodiscard]] ConstIterator end()          const noexcept { return cend(); }
+    [[nodiscard]] ConstIterator before_begin() const noexcept { return cbefore_begin(); }
+
+    [[nodiscard]] ConstIterator cbegin()        const noexcept { return ++cbefore_begin(); }
+    [[nodiscard]] ConstIterator cend()          const noexcept { return ConstIterator(nullptr); }
+    [[nodiscard]] ConstIterator cbefore_begin() const noexcept { return ConstIterator(const_cast<NodeBase*>(&head_)); }
+
+    // Функция получения размера. При одновременных изменениях значение приблизительное
+    [[nodiscard]] size_t GetSize() const noexcept { return size_.load(std::memory_order_relaxed); }
+
+    // Функция проверки на пустоту
+    [[nodiscard]] bool IsEmpty() const noexcept { return ToNode(head_.next_node.load()) == nullptr; }
+
+    // Функция добавления в начало списка
+    void PushFront(const Type& value) { EmplaceFront(value); }
+    void PushFront(Type&& value) { EmplaceFront(std::move(value)); }
+
+    // Функция создания элемента в начале списка из аргументов конструктора Type
+    template <typename... Args>
+    void EmplaceFront(Args&&... args) {
+        Node* node = new Node(std::forward<Args>(args)...);
+        std::uintptr_t first = head_.next_node.load();
+        do {
+            node->next_node.store(first, std::memory_order_relaxed);
+        } while (!head_.next_node.compare_exchange_weak(first, ToLink(node)));
+        size_.fetch_add(1u, std::memory_order_relaxed);
+    }
+
+    // Функция удаления из начала списка. Возвращает копию удалённого элемента или пустое значение, если список пуст
+    std::optional<Type> PopFront() {
+        const Guard guard = Pin();
+        return EraseAfterImpl(head_, *guard.slot_);
+    }
+
+    // Функция добавления после элемента, на который указывает итератор (вызывающий держит Guard).
+    // Возвращает false, если элемент pos уже удалён другим потоком
+    bool InsertAfter(ConstIterator pos, const Type& value) { return EmplaceAfter(pos, value); }
+    bool InsertAfter(ConstIterator pos, Type&& value) { return EmplaceAfter(pos, std::move(value)); }
+
+    // Функция создания элемента после элемента, на который указывает итератор (вызывающий держит Guard)
+    template <typename... Args>
+    bool EmplaceAfter(ConstIterator pos, Args&&... args) {
+        assert(pos.node_);
+
+        Node* node = new Node(std::forward<Args>(args)...);
+        std::uintptr_t next = pos.node_->next_node.load();
+        do {
+            if (IsMarked(next)) {
+                delete node;
+                return false;
+            }
+            node->next_node.store(next, std::memory_order_relaxed);
+        } while (!pos.node_->next_node.compare_exchange_weak(next, ToLink(node)));
+        size_.fetch_add(1u, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Функция удаления после элемента, на который указывает итератор (вызывающий держит Guard).
+    // Возвращает копию удалённого элемента или пустое значение, если удалять нечего или pos уже удалён
+    std::optional<Type> EraseAfter(ConstIterator pos) {
+        assert(pos.node_);
+        const Guard guard = Pin();
+        return EraseAfterImpl(*pos.node_, *guard.slot_);
+    }
+
+private:
+    NodeBase head_;                          // Фиктивный узел
+    std::atomic<size_t> size_{ 0u };         // Размер списка
+    mutable std::atomic<uint64_t> epoch_{ 1u }; // Глобальная эпоха
+    mutable Slot slots_[kGuardSlots];        // Слоты активных операций
+
+    // Функция удаления узла после pred: логическое удаление меткой, затем вырезание из списка
+    std::optional<Type> EraseAfterImpl(NodeBase& pred, Slot& slot) {
+        while (true) {
+            const std::uintptr_t link = pred.next_node.load();
+            if (IsMarked(link)) {
+                return std::nullopt;
+            }
+            Node* victim = ToNode(link);
+            if (!victim) {
+                return std::nullopt;
+            }
+
+            std::uintptr_t next = victim->next_node.load();
+            if (IsMarked(next)) {
+                // Узел уже удалён логически другим потоком - поможем вырезать его
+                TryUnlink(pred, victim, next, slot);
+                continue;
+            }
+
+            // Значение копируется до метки, чтобы исключение при копировании не потеряло элемент
+            std::optional<Type> value(victim->value);
+            if (!victim->next_node.compare_exchange_strong(next, Marked(next))) {
+                continue;
+            }
+            size_.fetch_sub(1u, std::memory_order_relaxed);
+
+            if (!TryUnlink(pred, victim, Marked(next), slot)) {
+                UnlinkMarked(pred, victim, slot);
+            }
+            return value;
+        }
+    }
+
+    // Функция вырезания помеченного узла victim, следующего за pred. Вырезавший поток освобождает узел
+    bool TryUnlink(NodeBase& pred, Node* victim, std::uintptr_t victim_next, Slot& slot) {
+        std::uintptr_t expected = ToLink(victim);
+        if (pred.next_node.compare_exchange_strong(expected, victim_next & ~std::uintptr_t{ 1u })) {
+            victim->unlinked.store(true);
+            Retire(victim, slot);
+            return true;
+        }
+        return false;
+    }
+
+    // Функция вырезания помеченного узла victim, если его не удалось вырезать сразу: между pred и victim
+    // вставлены новые узлы или pred сам удалён. Проход идёт от pred (или от начала списка, если pred удалён)
+    // до victim, по пути вырезаются все встреченные помеченные узлы. Проход заканчивается, как только
+    // victim вырезан этим или другим потоком
+    void UnlinkMarked(NodeBase& hint, Node* victim, Slot& slot) {
+        NodeBase* pred = &hint;
+        while (!victim->unlinked.load()) {
+            const std::uintptr_t link = pred->next_node.load();
+            Node* node = ToNode(link);
+            if (IsMarked(link) || !node) {
+                pred = &head_;
+                continue;
+            }
+
+            const std::uintptr_t next = node->next_node.load();
+            if (IsMarked(next)) {
+                TryUnlink(*pred, node, next, slot);
+            } else {
+                pred = node;
+            }
+        }
+    }
+
+    // Функция постановки вырезанного узла в очередь на освобождение
+    void Retire(Node* node, Slot& slot) const {
+        node->retire_epoch = epoch_.load();
+        node->retired_next = slot.retired;
+        slot.retired = node;
+        if (++slot.retired_count >= slot.reclaim_at) {
+            TryAdvanceEpoch();
+            FreeRetired(slot, epoch_.load());
+            // Если эпоху задерживает долгая операция, следующая попытка откладывается, чтобы проходы
+            // по списку ожидающих узлов не повторялись на каждом удалении
+            slot.reclaim_at = std::max(kReclaimThreshold, 2u * slot.retired_count);
+        }
+    }
+
+    // Функция перехода к следующей эпохе. Возможна, только если все активные операции начались в текущей эпохе
+    void TryAdvanceEpoch() const noexcept {
+        uint64_t epoch = epoch_.load();
+        for (const Slot& slot : slots_) {
+            const uint64_t slot_epoch = slot.epoch.load();
+            if (slot_epoch != 0u && slot_epoch != epoch) {
+                return;
+            }
+        }
+        epoch_.compare_exchange_strong(epoch, epoch + 1u);
+    }
+
+    // Функция освобождения узлов слота, вырезанных не позже чем за две эпохи до epoch
+    static void FreeRetired(Slot& slot, uint64_t epoch) noexcept {
+        Node** link = &slot.retired;
+        while (Node* node = *link) {
+            if (node->retire_epoch + 2u <= epoch || epoch == std::numeric_limits<uint64_t>::max()) {
+                *link = node->retired_next;
+                delete node;
+                --slot.retired_count;
+            } else {
+                link = &node->retired_next;
+            }
+        }
+    }
+
+    // Функция захвата свободного слота. Поиск начинается со слота, который поток занимал в прошлый раз
+    Slot& AcquireSlot() const noexcept {
+        thread_local size_t hint = std::hash<std::thread::id>()(std::this_thread::get_id());
+        size_t index = hint % kGuardSlots;
+        while (true) {
+            for (size_t i = 0u; i < kGuardSlots; ++i, index = (index + 1u) % kGuardSlots) {
+                bool expected = false;
+                if (!slots_[index].in_use.load(std::memory_order_relaxed)
+                    && slots_[index].in_use.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+                    hint = index;
+                    return slots_[index];
+                }
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    // Функция освобождения слота
+    void Unpin(Slot& slot) const noexcept {
+        slot.epoch.store(0u);
+        slot.in_use.store(false, std::memory_order_release);
+    }
+};
\ No newline at end of file
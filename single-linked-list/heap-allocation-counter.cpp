@@ -0,0 +1,65 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include "heap-allocation-counter.h"
+
+// Замена глобальных operator new и operator delete, считающая выделения памяти (см. heap-allocation-counter.h).
+// Заменяются все формы, в том числе с std::nothrow_t: память, выделенная через malloc, всегда освобождается
+// через free, и память из стандартной библиотеки (например, буфер std::stable_sort) не попадает в чужой delete
+namespace heap_allocation_counter {
+
+// Инициализация счётчиков константная, поэтому они готовы до первого operator new
+std::atomic<size_t> allocation_count{ 0u };
+std::atomic<size_t> allocated_bytes{ 0u };
+
+}
+
+namespace {
+
+// Функция учёта одного выделения памяти
+void CountAllocation(size_t bytes) noexcept {
+    heap_allocation_counter::allocation_count.fetch_add(1u, std::memory_order_relaxed);
+    heap_allocation_counter::allocated_bytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void* AllocateCounted(size_t size, size_t alignment) noexcept {
+    CountAllocation(size);
+    size = std::max<size_t>(size, 1u);
+    if (alignment <= alignof(std::max_align_t)) {
+        return std::malloc(size);
+    }
+    // aligned_alloc требует размер, кратный выравниванию
+    return std::aligned_alloc(alignment, (size + alignment - 1u) / alignment * alignment);
+}
+
+void* AllocateCountedOrThrow(size_t size, size_t alignment) {
+    if (void* ptr = AllocateCounted(size, alignment)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+}
+
+void* operator new(size_t size) { return AllocateCountedOrThrow(size, 0u); }
+void* operator new[](size_t size) { return AllocateCountedOrThrow(size, 0u); }
+void* operator new(size_t size, std::align_val_t align) { return AllocateCountedOrThrow(size, static_cast<size_t>(align)); }
+void* operator new[](size_t size, std::align_val_t align) { return AllocateCountedOrThrow(size, static_cast<size_t>(align)); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return AllocateCounted(size, 0u); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return AllocateCounted(size, 0u); }
+void* operator new(size_t size, std::align_val_t align, const std::nothrow_t&) noexcept { return AllocateCounted(size, static_cast<size_t>(align)); }
+void* operator new[](size_t size, std::align_val_t align, const std::nothrow_t&) noexcept { return AllocateCounted(size, static_cast<size_t>(align)); }
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, size_t, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { std::free(ptr); }
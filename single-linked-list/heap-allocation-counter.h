@@ -0,0 +1,23 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+
+// Счётчики выделений памяти в куче для тестов и бенчмарков. Их увеличивают глобальные operator new,
+// заменённые в heap-allocation-counter.cpp. Счётчики определены там же, поэтому программа, в которую
+// этот файл не собран, не компонуется, а не показывает нулевые выделения
+namespace heap_allocation_counter {
+
+extern std::atomic<size_t> allocation_count;
+extern std::atomic<size_t> allocated_bytes;
+
+// Количество выделений памяти через operator new с начала работы программы
+inline size_t GetAllocationCount() noexcept {
+    return allocation_count.load(std::memory_order_relaxed);
+}
+
+// Объём памяти, выделенной через operator new с начала работы программы
+inline size_t GetAllocatedBytes() noexcept {
+    return allocated_bytes.load(std::memory_order_relaxed);
+}
+
+}
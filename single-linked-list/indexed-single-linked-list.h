@@ -0,0 +1,499 @@
+#pragma once
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "single-linked-list.h"
+
+// Односвязный список с индексом для доступа по номеру элемента за O(√n). Список разбит на блоки
+// примерно по √n элементов; индекс хранит для каждого блока итератор на узел перед блоком, номер
+// первого элемента блока и размер блока. Доступ по номеру: двоичный поиск блока и проход внутри блока.
+// InsertAfter/EraseAfter/PushFront/PopFront/PushBack обновляют индекс сразу за O(√n) (размер блока и
+// номера следующих блоков), крупные изменения (SpliceAfter, Sort, Reverse) помечают индекс устаревшим,
+// и он перестраивается за O(n) при следующем обращении по номеру.
+// Итераторы помнят номер своего элемента. Номер действителен до следующего изменения списка; для
+// итератора, полученного до изменения, номер находится проходом вперёд до узла before следующего блока
+// (не больше одного блока, O(√n)); узлы before найдены по хеш-таблице. Без индекса
+// InsertAfter/EraseAfter номер не ищут и работают за O(1): возвращённый итератор помечается итератором
+// с неизвестным номером, который находится только при обращении к IndexOf/Advance
+template <typename Type, typename Allocator = std::allocator<Type>>
+class IndexedSingleLinkedList {
+public:
+    using List = SingleLinkedList<Type, Allocator>;
+
+private:
+    // Блок индекса: элементы с номерами [start; start + count), начинающиеся после узла before
+    struct Block {
+        typename List::Iterator before;
+        size_t start = 0u;
+        size_t count = 0u;
+    };
+
+    // Минимальный размер блока (на маленьких списках индекс не должен дробиться)
+    static constexpr size_t kMinBlockSize = 32u;
+
+    // Порядковый номер итератора, номер которого не известен (находится проходом по списку)
+    static constexpr size_t kUnknownOrdinal = static_cast<size_t>(-1);
+
+    // Класс итератора/константного итератора (ValueType=Type/const Type) списка
+    template <typename ValueType>
+    class BasicIterator {
+        // Предоставим классу списка доступ к приватным полям и методам
+        friend class IndexedSingleLinkedList;
+
+    public:
+        // Описание типа итератора
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = ValueType*;
+        using reference = ValueType&;
+
+        // Конструктор по умолчанию
+        BasicIterator() = default;
+
+        // Конструктор копирования
+        BasicIterator(const BasicIterator<Type>& other) noexcept
+            : it_(other.it_), ordinal_(other.ordinal_), version_(other.version_) { }
+
+        // Оператор присваивания
+        BasicIterator& operator = (const BasicIterator& rhs) = default;
+
+        // Операторы сравнения неконстантных итераторов (ValueType = Type)
+        [[nodiscard]] bool operator == (const BasicIterator<Type>& rhs) const noexcept { return it_ == rhs.it_; }
+        [[nodiscard]] bool operator != (const BasicIterator<Type>& rhs) const noexcept { return !(*this == rhs); }
+
+        // Операторы сравнения константных итераторов (ValueType = const Type)
+        [[nodiscard]] bool operator == (const BasicIterator<const Type>& rhs) const noexcept { return it_ == rhs.it_; }
+        [[nodiscard]] bool operator != (const BasicIterator<const Type>& rhs) const noexcept { return !(*this == rhs); }
+
+        // Преинкремент
+        BasicIterator& operator ++ () noexcept {
+            ++it_;
+            if (ordinal_ != kUnknownOrdinal) {
+                ++ordinal_;
+            }
+            return *this;
+        }
+
+        // Постинкремент
+        BasicIterator operator ++ (int) noexcept {
+            BasicIterator tmp(*this);
+            ++(*this);
+            return tmp;
+        }
+
+        // Оператор разыменовывания
+        [[nodiscard]] reference operator * () const noexcept { return *it_; }
+
+        // Оператор доступа к членам
+        [[nodiscard]] pointer operator -> () const noexcept { return &*it_; }
+
+    private:
+        typename List::Iterator it_;  // Итератор списка
+        size_t ordinal_ = 0u;         // Порядковый номер узла: 0 - фиктивный узел, k + 1 - элемент с номером k,
+                                      // kUnknownOrdinal - номер не известен
+        uint64_t version_ = 0u;       // Версия списка, для которой номер действителен
+
+        BasicIterator(typename List::Iterator it, size_t ordinal, uint64_t version) noexcept
+            : it_(it), ordinal_(ordinal), version_(version) { }
+
+        template <typename> friend class BasicIterator;
+    };
+
+public:
+    // Псевдонимы для типов, ссылок, константных ссылок, итераторов и константных итераторов
+    using value_type = Type;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+    using Iterator      = BasicIterator<Type>;
+    using ConstIterator = BasicIterator<const Type>;
+
+    // Конструктор по умолчанию создаёт пустой список
+    IndexedSingleLinkedList() = default;
+
+    // Конструктор, создающий список из элементов std::initializer_list
+    IndexedSingleLinkedList(std::initializer_list<Type> values) : list_(values) { }
+
+    // Конструктор, принимающий готовый список (индекс строится при первом обращении по номеру)
+    explicit IndexedSingleLinkedList(List list) noexcept : list_(std::move(list)) { }
+
+    // Копирование и перемещение: индекс хранит итераторы своего списка, поэтому не переносится
+    IndexedSingleLinkedList(const IndexedSingleLinkedList& other) : list_(other.list_) { }
+    IndexedSingleLinkedList(IndexedSingleLinkedList&& other) noexcept : list_(std::move(other.list_)) { other.Invalidate(); }
+
+    IndexedSingleLinkedList& operator = (const IndexedSingleLinkedList& rhs) {
+        if (this != &rhs) {
+            list_ = rhs.list_;
+            Invalidate();
+        }
+        return *this;
+    }
+
+    IndexedSingleLinkedList& operator = (IndexedSingleLinkedList&& rhs) noexcept {
+        if (this != &rhs) {
+            list_ = std::move(rhs.list_);
+            Invalidate();
+            rhs.Invalidate();
+        }
+        return *this;
+    }
+
+    // Итераторы, указывающие на начало, конец и фиктивный узел списка
+    [[nodiscard]] Iterator begin()        noexcept { return Iterator(list_.begin(), 1u, version_); }
+    [[nodiscard]] Iterator end()          noexcept { return Iterator(list_.end(), GetSize() + 1u, version_); }
+    [[nodiscard]] Iterator before_begin() noexcept { return Iterator(list_.before_begin(), 0u, version_); }
+    [[nodiscard]] Iterator before_end()   noexcept { return Iterator(list_.before_end(), GetSize(), version_); }
+
+    // Константные итераторы, указывающие на начало, конец и фиктивный узел списка
+    [[nodiscard]] ConstIterator begin()        const noexcept { return cbegin(); }
+    [[nodiscard]] ConstIterator end()          const noexcept { return cend(); }
+    [[nodiscard]] ConstIterator before_begin() const noexcept { return cbefore_begin(); }
+    [[nodiscard]] ConstIterator before_end()   const noexcept { return cbefore_end(); }
+
+    [[nodiscard]] ConstIterator cbegin()        const noexcept { return Mutable().begin(); }
+    [[nodiscard]] ConstIterator cend()          const noexcept { return Mutable().end(); }
+    [[nodiscard]] ConstIterator cbefore_begin() const noexcept { return Mutable().before_begin(); }
+    [[nodiscard]] ConstIterator cbefore_end()   const noexcept { return Mutable().before_end(); }
+
+    // Функция доступа к списку без индекса (только для чтения)
+    [[nodiscard]] const List& GetList() const noexcept { return list_; }
+
+    // Функция получения размера
+    [[nodiscard]] size_t GetSize() const noexcept { return list_.GetSize(); }
+
+    // Функция проверки на пустоту
+    [[nodiscard]] bool IsEmpty() const noexcept { return list_.IsEmpty(); }
+
+    // Функции доступа к первому и последнему элементам списка
+    [[nodiscard]] reference       front()       noexcept { return list_.front(); }
+    [[nodiscard]] const_reference front() const noexcept { return list_.front(); }
+    [[nodiscard]] reference       back()        noexcept { return list_.back(); }
+    [[nodiscard]] const_reference back()  const noexcept { return list_.back(); }
+
+    // Итератор на элемент с номером index (index == GetSize() - end()) за O(√n)
+    [[nodiscard]] Iterator IteratorAt(size_t index) {
+        assert(index <= GetSize());
+        if (index == GetSize()) {
+            return end();
+        }
+        EnsureIndex();
+        const Block& block = *FindBlock(index);
+        return Iterator(std::next(block.before, static_cast<std::ptrdiff_t>(index - block.start + 1u)), index + 1u, version_);
+    }
+
+    [[nodiscard]] ConstIterator IteratorAt(size_t index) const { return Mutable().IteratorAt(index); }
+
+    // Доступ к элементу с номером index за O(√n). При index >= GetSize() выбрасывает std::out_of_range
+    [[nodiscard]] reference At(size_t index) {
+        if (index >= GetSize()) {
+            throw std::out_of_range("IndexedSingleLinkedList index is out of range");
+        }
+        return *IteratorAt(index);
+    }
+
+    [[nodiscard]] const_reference At(size_t index) const { return Mutable().At(index); }
+
+    // Итератор, отстоящий от it на count элементов вперёд, за O(√n) (it + count не дальше end())
+    [[nodiscard]] Iterator Advance(ConstIterator it, size_t count) {
+        const size_t ordinal = OrdinalOf(it);
+        assert(ordinal + count <= GetSize() + 1u);
+        if (ordinal + count == 0u) {
+            return before_begin();
+        }
+        return IteratorAt(ordinal + count - 1u);
+    }
+
+    [[nodiscard]] ConstIterator Advance(ConstIterator it, size_t count) const { return Mutable().Advance(it, count); }
+
+    // Номер элемента, на который указывает итератор (для end() - GetSize()), за O(√n)
+    [[nodiscard]] size_t IndexOf(ConstIterator it) const {
+        const size_t ordinal = OrdinalOf(it);
+        assert(ordinal > 0u);
+        return ordinal - 1u;
+    }
+
+    // Функция добавления в начало списка
+    void PushFront(const Type& value) { InsertAfter(cbefore_begin(), value); }
+    void PushFront(Type&& value) { InsertAfter(cbefore_begin(), std::move(value)); }
+
+    // Функция удаления из начала списка
+    void PopFront() noexcept {
+        assert(!IsEmpty());
+        EraseAfter(cbefore_begin());
+    }
+
+    // Функция добавления в конец списка
+    void PushBack(const Type& value) { InsertAfter(cbefore_end(), value); }
+    void PushBack(Type&& value) { InsertAfter(cbefore_end(), std::move(value)); }
+
+    // Функция добавления после элемента, на который указывает итератор
+    Iterator InsertAfter(ConstIterator pos, const Type& value) { return EmplaceAfter(pos, value); }
+    Iterator InsertAfter(ConstIterator pos, Type&& value) { return EmplaceAfter(pos, std::move(value)); }
+
+    // Функция создания элемента после элемента, на который указывает итератор, из аргументов конструктора Type
+    template <typename... Args>
+    Iterator EmplaceAfter(ConstIterator pos, Args&&... args) {
+        const size_t ordinal = index_valid_ ? IndexedOrdinalOf(pos) : KnownOrdinalOf(pos);
+        const typename List::Iterator inserted = list_.EmplaceAfter(pos.it_, std::forward<Args>(args)...);
+        ++version_;
+        if (index_valid_) {
+            // Элемент уже вставлен: если обновить индекс не удалось, индекс помечается устаревшим
+            try {
+                OnInserted(ordinal);
+            } catch (...) {
+                Invalidate();
+            }
+        }
+        return Iterator(inserted, NextOrdinal(ordinal), version_);
+    }
+
+    // Функция удаления после элемента, на который указывает итератор
+    Iterator EraseAfter(ConstIterator pos) noexcept {
+        const size_t ordinal = index_valid_ ? IndexedOrdinalOf(pos) : KnownOrdinalOf(pos);
+        if (index_valid_) {
+            OnErasing(ordinal, pos.it_);
+        }
+        const typename List::Iterator next = list_.EraseAfter(pos.it_);
+        ++version_;
+        return Iterator(next, NextOrdinal(ordinal), version_);
+    }
+
+    // Функция переноса всех элементов списка other после элемента, на который указывает итератор.
+    // Индекс помечается устаревшим и перестраивается при следующем обращении по номеру
+    void SpliceAfter(ConstIterator pos, List& other) noexcept {
+        list_.SpliceAfter(pos.it_, other);
+        Invalidate();
+    }
+
+    void SpliceAfter(ConstIterator pos, List&& other) noexcept { SpliceAfter(pos, other); }
+
+    // Сортировка и разворот списка (индекс помечается устаревшим)
+    template <typename Compare = std::less<>>
+    void Sort(Compare comp = Compare()) {
+        Invalidate();
+        list_.Sort(comp);
+    }
+
+    void Reverse() noexcept {
+        list_.Reverse();
+        Invalidate();
+    }
+
+    // Очистка списка
+    void Clear() noexcept {
+        list_.Clear();
+        Invalidate();
+    }
+
+    // Функция обмена с другим списком (индексы обоих списков помечаются устаревшими)
+    void swap(IndexedSingleLinkedList& other) noexcept {
+        list_.swap(other.list_);
+        Invalidate();
+        other.Invalidate();
+    }
+
+private:
+    List list_;
+    // Индекс строится лениво и в константных функциях доступа по номеру
+    mutable std::vector<Block> blocks_;  // Блоки индекса по порядку
+    mutable size_t block_size_ = 0u;     // Размер блока, выбранный при построении индекса
+    mutable bool index_valid_ = false;   // Индекс соответствует списку
+    mutable std::unordered_map<const Type*, size_t> block_after_;  // Номер блока по элементу, который
+                                                                    // служит узлом before этого блока
+    uint64_t version_ = 0u;              // Номер изменения списка (номера итераторов действительны в пределах версии)
+
+    IndexedSingleLinkedList& Mutable() const noexcept { return const_cast<IndexedSingleLinkedList&>(*this); }
+
+    // Функция пометки индекса устаревшим
+    void Invalidate() noexcept {
+        index_valid_ = false;
+        blocks_.clear();
+        block_after_.clear();
+        ++version_;
+    }
+
+    // Функция построения индекса за O(n), если он устарел
+    void EnsureIndex() {
+        if (index_valid_) {
+            return;
+        }
+
+        const size_t size = GetSize();
+        block_size_ = std::max(kMinBlockSize, static_cast<size_t>(std::sqrt(static_cast<double>(size))));
+        blocks_.clear();
+        blocks_.reserve(size / block_size_ + 1u);
+        typename List::Iterator before = list_.before_begin();
+        for (size_t start = 0u; start < size; start += block_size_) {
+            const size_t count = std::min(block_size_, size - start);
+            blocks_.push_back({ before, start, count });
+            std::advance(before, static_cast<std::ptrdiff_t>(count));
+        }
+        block_after_.clear();
+        block_after_.reserve(blocks_.size());
+        RenumberBlocks(1u);
+        index_valid_ = true;
+    }
+
+    // Функция поиска блока, содержащего элемент с номером index (двоичный поиск)
+    typename std::vector<Block>::iterator FindBlock(size_t index) noexcept {
+        assert(!blocks_.empty());
+        auto it = std::upper_bound(blocks_.begin(), blocks_.end(), index,
+                                   [](size_t value, const Block& block) { return value < block.start; });
+        return std::prev(it);
+    }
+
+    // Порядковый номер узла итератора без прохода по списку: из итератора, если он получен в текущей
+    // версии, иначе kUnknownOrdinal
+    size_t KnownOrdinalOf(const ConstIterator& it) const noexcept {
+        return it.version_ == version_ || it.ordinal_ == 0u ? it.ordinal_ : kUnknownOrdinal;
+    }
+
+    // Порядковый номер узла, следующего за узлом с номером ordinal (неизвестный номер остаётся неизвестным)
+    static size_t NextOrdinal(size_t ordinal) noexcept {
+        return ordinal == kUnknownOrdinal ? kUnknownOrdinal : ordinal + 1u;
+    }
+
+    // Порядковый номер узла итератора: из итератора, если он известен в текущей версии, иначе по индексу
+    // (индекс строится, если он устарел)
+    size_t OrdinalOf(const ConstIterator& it) const {
+        if (const size_t ordinal = KnownOrdinalOf(it); ordinal != kUnknownOrdinal) {
+            return ordinal;
+        }
+        Mutable().EnsureIndex();
+        return IndexedOrdinalOf(it);
+    }
+
+    // Порядковый номер узла итератора при построенном индексе. Неизвестный номер находится проходом вперёд
+    // до узла before следующего блока (или до конца списка): узлы блока идут подряд, поэтому проход
+    // не длиннее блока
+    size_t IndexedOrdinalOf(const ConstIterator& it) const noexcept {
+        assert(index_valid_);
+        if (const size_t ordinal = KnownOrdinalOf(it); ordinal != kUnknownOrdinal) {
+            return ordinal;
+        }
+        size_t steps = 0u;
+        for (auto node = it.it_; node != list_.end(); ++node, ++steps) {
+            if (const auto found = block_after_.find(&*node); found != block_after_.end()) {
+                return blocks_[found->second].start - steps;
+            }
+        }
+        return GetSize() + 1u - steps;
+    }
+
+    // Обновление номеров блоков в block_after_, начиная с блока first (у блока 0 узел before - фиктивный)
+    void RenumberBlocks(size_t first) {
+        for (size_t block = std::max<size_t>(first, 1u); block < blocks_.size(); ++block) {
+            block_after_[&*blocks_[block].before] = block;
+        }
+    }
+
+    // Обновление индекса после вставки элемента с номером ordinal. Элемент, вставленный сразу за узлом
+    // before блока, становится первым элементом этого блока, поэтому узлы before не меняются
+    void OnInserted(size_t ordinal) {
+        const size_t size = GetSize();
+        if (blocks_.empty()) {
+            blocks_.push_back({ list_.before_begin(), 0u, 1u });
+            return;
+        }
+        // Слишком выросший список перестраивается, чтобы блоки оставались порядка √n
+        if (size > 4u * block_size_ * block_size_) {
+            Invalidate();
+            return;
+        }
+
+        const auto block = ordinal + 1u == size ? std::prev(blocks_.end()) : FindBlock(ordinal);
+        ++block->count;
+        for (auto it = std::next(block); it != blocks_.end(); ++it) {
+            ++it->start;
+        }
+        if (block->count > 2u * block_size_) {
+            SplitBlock(block);
+        }
+    }
+
+    // Обновление индекса перед удалением элемента с номером ordinal (следующего за pos). Если обновить
+    // block_after_ не удалось, индекс помечается устаревшим
+    void OnErasing(size_t ordinal, typename List::Iterator pos) noexcept {
+        const auto block = FindBlock(ordinal);
+        const auto next = std::next(block);
+        const size_t next_number = static_cast<size_t>(next - blocks_.begin());
+        bool renumber = false;
+        if (next != blocks_.end() && next->start == ordinal + 1u) {
+            // Удаляется последний элемент блока, то есть узел before следующего блока
+            block_after_.erase(&*next->before);
+            next->before = pos;
+            renumber = true;
+        }
+        for (auto it = next; it != blocks_.end(); ++it) {
+            --it->start;
+        }
+        if (--block->count == 0u) {
+            if (next_number > 1u) {
+                block_after_.erase(&*block->before);
+            }
+            blocks_.erase(block);
+            renumber = true;
+        }
+        if (renumber) {
+            try {
+                RenumberBlocks(next_number - 1u);
+            } catch (...) {
+                Invalidate();
+            }
+        }
+    }
+
+    // Разделение блока на два: первые block_size_ элементов и остальные
+    void SplitBlock(typename std::vector<Block>::iterator block) {
+        const Block tail{ std::next(block->before, static_cast<std::ptrdiff_t>(block_size_)), block->start + block_size_, block->count - block_size_ };
+        block->count = block_size_;
+        const size_t tail_number = static_cast<size_t>(block - blocks_.begin()) + 1u;
+        blocks_.insert(std::next(block), tail);
+        RenumberBlocks(tail_number);
+    }
+};
+
+// Функция обмена формата swap(lhs, rhs)
+template <typename Type, typename Allocator>
+void swap(IndexedSingleLinkedList<Type, Allocator>& lhs, IndexedSingleLinkedList<Type, Allocator>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+// Операторы сравнения списков (по элементам)
+template <typename Type, typename Allocator>
+bool operator == (const IndexedSingleLinkedList<Type, Allocator>& lhs, const IndexedSingleLinkedList<Type, Allocator>& rhs) {
+    return lhs.GetList() == rhs.GetList();
+}
+
+template <typename Type, typename Allocator>
+bool operator < (const IndexedSingleLinkedList<Type, Allocator>& lhs, const IndexedSingleLinkedList<Type, Allocator>& rhs) {
+    return lhs.GetList() < rhs.GetList();
+}
+
+template <typename Type, typename Allocator>
+bool operator != (const IndexedSingleLinkedList<Type, Allocator>& lhs, const IndexedSingleLinkedList<Type, Allocator>& rhs) { return !(lhs == rhs); }
+
+template <typename Type, typename Allocator>
+bool operator >  (const IndexedSingleLinkedList<Type, Allocator>& lhs, const IndexedSingleLinkedList<Type, Allocator>& rhs) { return rhs < lhs; }
+
+template <typename Type, typename Allocator>
+bool operator <= (const IndexedSingleLinkedList<Type, Allocator>& lhs, const IndexedSingleLinkedList<Type, Allocator>& rhs) { return !(rhs < lhs); }
+
+template <typename Type, typename Allocator>
+bool operator >= (const IndexedSingleLinkedList<Type, Allocator>& lhs, const IndexedSingleLinkedList<Type, Allocator>& rhs) { return !(lhs < rhs); }
+
+// Оператор "<<" для вывода содержимого списка в поток
+template <typename Type, typename Allocator>
+std::ostream& operator << (std::ostream& os, const IndexedSingleLinkedList<Type, Allocator>& indexed_list) {
+    return os << indexed_list.GetList();
+}
@@ -0,0 +1,325 @@
+#pragma once
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+// Интрузивный односвязный список: связь хранится в самом элементе (в крючке IntrusiveListHook),
+// поэтому список не выделяет память и не копирует элементы - он лишь связывает уже существующие объекты.
+// Список не владеет элементами: элемент должен жить, пока он в списке, а удаление из списка его не
+// уничтожает. Один объект может одновременно состоять в нескольких списках с разными крючками (Tag)
+
+// Крючок списка. Копирование объекта с крючком не копирует связь: копия создаётся не связанной,
+// а присваивание не меняет связь объекта, которому присваивают
+template <typename Tag = void>
+class IntrusiveListHook {
+public:
+    IntrusiveListHook() noexcept = default;
+    IntrusiveListHook(const IntrusiveListHook&) noexcept { }
+    IntrusiveListHook& operator = (const IntrusiveListHook&) noexcept { return *this; }
+
+private:
+    template <typename, typename> friend class IntrusiveSingleLinkedList;
+
+    IntrusiveListHook* next_node = nullptr;
+};
+
+// Способ доступа к крючку: Type наследует IntrusiveListHook<Tag>
+template <typename Type, typename Tag = void>
+struct IntrusiveBaseHook {
+    using Hook = IntrusiveListHook<Tag>;
+
+    static Hook* ToHook(Type& value) noexcept { return &static_cast<Hook&>(value); }
+    static Type& FromHook(Hook* hook) noexcept { return static_cast<Type&>(*hook); }
+};
+
+// Способ доступа к крючку: крючок - поле Member типа Type
+template <typename Type, typename Tag, IntrusiveListHook<Tag> Type::* Member>
+struct IntrusiveMemberHook {
+    using Hook = IntrusiveListHook<Tag>;
+
+    static Hook* ToHook(Type& value) noexcept { return &(value.*Member); }
+
+    static Type& FromHook(Hook* hook) noexcept {
+        return *reinterpret_cast<Type*>(reinterpret_cast<std::byte*>(hook) - MemberOffset());
+    }
+
+private:
+    // Смещение поля-крючка от начала объекта
+    static std::ptrdiff_t MemberOffset() noexcept {
+        alignas(Type) static std::byte object[sizeof(Type)];
+        Type* value = reinterpret_cast<Type*>(object);
+        return reinterpret_cast<std::byte*>(&(value->*Member)) - object;
+    }
+};
+
+// Класс интрузивного списка элементов типа Type. HookAccess - способ доступа к крючку
+// (IntrusiveBaseHook или IntrusiveMemberHook). Интерфейс повторяет SingleLinkedList, но элементы
+// передаются по ссылке и связываются без копирования
+template <typename Type, typename HookAccess = IntrusiveBaseHook<Type>>
+class IntrusiveSingleLinkedList {
+private:
+    using Hook = typename HookAccess::Hook;
+
+    // Класс итератора/константного итератора (ValueType=Type/const Type) списка
+    template <typename ValueType>
+    class BasicIterator {
+        // Предоставим классу списка доступ к приватным полям и методам
+        friend class IntrusiveSingleLinkedList;
+
+    public:
+        // Описание типа итератора
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = ValueType*;
+        using reference = ValueType&;
+
+        // Конструктор по умолчанию
+        BasicIterator() = default;
+
+        // Конструктор копирования
+        BasicIterator(const BasicIterator<Type>& other) noexcept : node_(other.node_) { }
+
+        // Оператор присваивания
+        BasicIterator& operator = (const BasicIterator& rhs) = default;
+
+        // Операторы сравнения неконстантных итераторов (ValueType = Type)
+        [[nodiscard]] bool operator == (const BasicIterator<Type>& rhs) const noexcept { return node_ == rhs.node_; }
+        [[nodiscard]] bool operator != (const BasicIterator<Type>& rhs) const noexcept { return !(*this == rhs); }
+
+        // Операторы сравнения константных итераторов (ValueType = const Type)
+        [[nodiscard]] bool operator == (const BasicIterator<const Type>& rhs) const noexcept { return node_ == rhs.node_; }
+        [[nodiscard]] bool operator != (const BasicIterator<const Type>& rhs) const noexcept { return !(*this == rhs); }
+
+        // Преинкремент
+        BasicIterator& operator ++ () noexcept {
+            assert(node_);
+            node_ = node_->next_node;
+            return *this;
+        }
+
+        // Постинкремент
+        BasicIterator operator ++ (int) noexcept {
+            BasicIterator tmp(*this);
+            ++(*this);
+            return tmp;
+        }
+
+        // Оператор разыменовывания
+        [[nodiscard]] reference operator * () const noexcept {
+            assert(node_);
+            return HookAccess::FromHook(node_);
+        }
+
+        // Оператор доступа к членам
+        [[nodiscard]] pointer operator -> () const noexcept {
+            return &(**this);
+        }
+
+    private:
+        // Указатель на крючок элемента (или на фиктивный узел)
+        Hook* node_ = nullptr;
+
+        // Конструктор, создающий итератор из указателя на крючок (используется в классе списка)
+        explicit BasicIterator(Hook* node) noexcept : node_(node) { }
+
+        template <typename> friend class BasicIterator;
+    };
+
+public:
+    // Псевдонимы для типов, ссылок, константных ссылок, итераторов и константных итераторов
+    using value_type = Type;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+    using Iterator      = BasicIterator<Type>;
+    using ConstIterator = BasicIterator<const Type>;
+
+    // Конструктор по умолчанию создаёт пустой список
+    IntrusiveSingleLinkedList() noexcept = default;
+
+    // Конструктор, связывающий в список элементы интервала [first; last) (итераторы на Type&)
+    template <typename InputIterator>
+    IntrusiveSingleLinkedList(InputIterator first, InputIterator last) noexcept {
+        for (; first != last; ++first) {
+            PushBack(*first);
+        }
+    }
+
+    // Список связывает чужие объекты, поэтому не копируется
+    IntrusiveSingleLinkedList(const IntrusiveSingleLinkedList&) = delete;
+    IntrusiveSingleLinkedList& operator = (const IntrusiveSingleLinkedList&) = delete;
+
+    // Конструктор перемещения: элементы переходят к новому списку
+    IntrusiveSingleLinkedList(IntrusiveSingleLinkedList&& other) noexcept { swap(other); }
+
+    // Оператор перемещающего присваивания
+    IntrusiveSingleLinkedList& operator = (IntrusiveSingleLinkedList&& rhs) noexcept {
+        if (this != &rhs) {
+            Clear();
+            swap(rhs);
+        }
+        return *this;
+    }
+
+    // Деструктор отвязывает элементы, но не уничтожает их
+    ~IntrusiveSingleLinkedList() noexcept { Clear(); }
+
+    // Итераторы, указывающие на начало, конец и фиктивный узел списка
+    [[nodiscard]] Iterator begin()        noexcept { return Iterator(head_.next_node); }
+    [[nodiscard]] Iterator end()          noexcept { return Iterator(nullptr); }
+    [[nodiscard]] Iterator before_begin() noexcept { return Iterator(&head_); }
+
+    // Итератор, указывающий на последний элемент списка (на фиктивный узел, если список пуст)
+    [[nodiscard]] Iterator      before_end()        noexcept { return Iterator(tail_); }
+    [[nodiscard]] ConstIterator before_end()  const noexcept { return cbefore_end(); }
+    [[nodiscard]] ConstIterator cbefore_end() const noexcept { return ConstIterator(tail_); }
+
+    // Константные итераторы, указывающие на начало, конец и фиктивный узел списка
+    [[nodiscard]] ConstIterator begin()        const noexcept { return cbegin(); }
+    [[nodiscard]] ConstIterator end()          const noexcept { return cend(); }
+    [[nodiscard]] ConstIterator before_begin() const noexcept { return cbefore_begin(); }
+
+    [[nodiscard]] ConstIterator cbegin()        const noexcept { return ConstIterator(head_.next_node); }
+    [[nodiscard]] ConstIterator cend()          const noexcept { return ConstIterator(nullptr); }
+    [[nodiscard]] ConstIterator cbefore_begin() const noexcept { return ConstIterator(const_cast<Hook*>(&head_)); }
+
+    // Итератор, указывающий на элемент value этого списка, за O(1)
+    [[nodiscard]] Iterator      IteratorTo(Type& value)       noexcept { return Iterator(HookAccess::ToHook(value)); }
+    [[nodiscard]] ConstIterator IteratorTo(const Type& value) const noexcept {
+        return ConstIterator(HookAccess::ToHook(const_cast<Type&>(value)));
+    }
+
+    // Функция обмена с другим списком. Итераторы на элементы остаются действительными,
+    // итераторы before_begin() указывают на фиктивный узел своего списка
+    void swap(IntrusiveSingleLinkedList& other) noexcept {
+        std::swap(head_.next_node, other.head_.next_node);
+        std::swap(tail_, other.tail_);
+        std::swap(size_, other.size_);
+        if (tail_ == &other.head_) tail_ = &head_;
+        if (other.tail_ == &head_) other.tail_ = &other.head_;
+    }
+
+    // Функция получения размера
+    [[nodiscard]] size_t GetSize() const noexcept { return size_; }
+
+    // Функция проверки на пустоту
+    [[nodiscard]] bool IsEmpty() const noexcept { return size_ == 0u; }
+
+    // Функции доступа к первому и последнему элементам списка
+    [[nodiscard]] reference       front()       noexcept { assert(!IsEmpty()); return *begin(); }
+    [[nodiscard]] const_reference front() const noexcept { assert(!IsEmpty()); return *cbegin(); }
+    [[nodiscard]] reference       back()        noexcept { assert(!IsEmpty()); return *before_end(); }
+    [[nodiscard]] const_reference back()  const noexcept { assert(!IsEmpty()); return *cbefore_end(); }
+
+    // Функция добавления в начало списка
+    void PushFront(Type& value) noexcept { InsertAfter(cbefore_begin(), value); }
+
+    // Функция удаления из начала списка
+    void PopFront() noexcept {
+        assert(!IsEmpty());
+        EraseAfter(cbefore_begin());
+    }
+
+    // Функция добавления в конец списка за O(1)
+    void PushBack(Type& value) noexcept { InsertAfter(cbefore_end(), value); }
+
+    // Функция удаления из конца списка за O(n)
+    void PopBack() noexcept {
+        assert(!IsEmpty());
+
+        Hook* pre_back = &head_;
+        while (pre_back->next_node != tail_) { pre_back = pre_back->next_node; }
+        EraseAfter(ConstIterator(pre_back));
+    }
+
+    // Функция добавления элемента value после элемента, на который указывает итератор.
+    // Элемент не должен состоять в другом списке с тем же крючком
+    Iterator InsertAfter(ConstIterator pos, Type& value) noexcept {
+        assert(pos.node_);
+
+        Hook* node = HookAccess::ToHook(value);
+        node->next_node = pos.node_->next_node;
+        pos.node_->next_node = node;
+        if (pos.node_ == tail_) tail_ = node;
+        ++size_;
+        return Iterator(node);
+    }
+
+    // Функция удаления после элемента, на который указывает итератор. Элемент отвязывается, но не уничтожается
+    Iterator EraseAfter(ConstIterator pos) noexcept {
+        assert(pos.node_ && pos.node_->next_node);
+
+        Hook* node = pos.node_->next_node;
+        pos.node_->next_node = node->next_node;
+        if (node == tail_) tail_ = pos.node_;
+        node->next_node = nullptr;
+        --size_;
+        return Iterator(pos.node_->next_node);
+    }
+
+    // Очистка списка за O(n): элементы отвязываются, но не уничтожаются
+    void Clear() noexcept {
+        for (Hook* node = head_.next_node; node;) {
+            node = std::exchange(node->next_node, nullptr);
+        }
+        head_.next_node = nullptr;
+        tail_ = &head_;
+        size_ = 0u;
+    }
+
+private:
+    Hook head_;            // Фиктивный узел
+    Hook* tail_ = &head_;  // Последний узел (фиктивный, если список пуст)
+    size_t size_ = 0u;     // Размер списка
+};
+
+// Функция обмена формата swap(lhs, rhs)
+template <typename Type, typename HookAccess>
+void swap(IntrusiveSingleLinkedList<Type, HookAccess>& lhs, IntrusiveSingleLinkedList<Type, HookAccess>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+// Оператор сравнения списков "=="
+template <typename Type, typename HookAccess>
+bool operator == (const IntrusiveSingleLinkedList<Type, HookAccess>& lhs, const IntrusiveSingleLinkedList<Type, HookAccess>& rhs) {
+    return lhs.GetSize() == rhs.GetSize() && std::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin());
+}
+
+// Оператор сравнения списков "<"
+template <typename Type, typename HookAccess>
+bool operator < (const IntrusiveSingleLinkedList<Type, HookAccess>& lhs, const IntrusiveSingleLinkedList<Type, HookAccess>& rhs) {
+    return std::lexicographical_compare(lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend());
+}
+
+// Производные от "==" и "<" операторы сравнения списков
+template <typename Type, typename HookAccess>
+bool operator != (const IntrusiveSingleLinkedList<Type, HookAccess>& lhs, const IntrusiveSingleLinkedList<Type, HookAccess>& rhs) { return !(lhs == rhs); }
+
+template <typename Type, typename HookAccess>
+bool operator >  (const IntrusiveSingleLinkedList<Type, HookAccess>& lhs, const IntrusiveSingleLinkedList<Type, HookAccess>& rhs) { return rhs < lhs; }
+
+template <typename Type, typename HookAccess>
+bool operator <= (const IntrusiveSingleLinkedList<Type, HookAccess>& lhs, const IntrusiveSingleLinkedList<Type, HookAccess>& rhs) { return !(rhs < lhs); }
+
+template <typename Type, typename HookAccess>
+bool operator >= (const IntrusiveSingleLinkedList<Type, HookAccess>& lhs, const IntrusiveSingleLinkedList<Type, HookAccess>& rhs) { return !(lhs < rhs); }
+
+// Оператор "<<" для вывода содержимого списка в поток
+template <typename Type, typename HookAccess>
+std::ostream& operator << (std::ostream& os, const IntrusiveSingleLinkedList<Type, HookAccess>& intrusive_list) {
+    using namespace std::literals;
+    os << "{"s;
+    bool first = true;
+    for (const Type& element : intrusive_list) {
+        if (!first) os << ", "s;
+        else        first = false;
+        os << element;
+    }
+    os << "}"s;
+    return os;
+}
@@ -18,6 +18,15 @@ ostream& operator << (ostream& os, const Point& p) {
 // Тестирование и демонстрация работы списка
 int main() {
     unit_tests::RunTestSingleLinkedList();
+    unit_tests::RunTestUnrolledSingleLinkedList();
+    unit_tests::RunTestCompactSingleLinkedList();
+    unit_tests::RunTestIndexedSingleLinkedList();
+    unit_tests::RunTestSmallSingleLinkedList();
+    unit_tests::RunTestPersistentSingleLinkedList();
+    unit_tests::RunTestHashMap();
+    unit_tests::RunTestIntrusiveSingleLinkedList();
+    unit_tests::RunTestConcurrentSingleLinkedList();
+    unit_tests::RunTestMappedSingleLinkedList();
 
     {
         SingleLinkedList<Point> mylist = { {1, 2}, {3, 4}, {5, 6}, {7, 8} };
@@ -0,0 +1,497 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Класс односвязного списка, узлы которого хранятся в отображённом в память файле (mmap).
+// Узлы связаны смещениями от начала файла, а не указателями, поэтому после перезапуска процесса
+// файл открывается и сразу готов к обходу, без десериализации. Элементы хранятся побайтово и должны
+// быть тривиально копируемыми.
+//
+// Согласованность при аварийном завершении процесса: каждое изменение связей списка делается одной
+// записью 8-байтового смещения (новый узел полностью записывается до того, как на него появится ссылка),
+// поэтому связи в файле всегда образуют корректный список. Служебные поля (размер, последний узел,
+// список свободных узлов) на время операции помечаются как ненадёжные; если процесс завершился
+// посреди операции, они восстанавливаются при следующем открытии файла проходом по списку.
+// Для защиты от сбоя питания нужно вызывать Sync() в моменты, когда список не меняется.
+//
+// Новый файл сначала полностью записывается во временный файл path + ".tmp" и только потом атомарно
+// переименовывается в path, поэтому аварийное завершение при создании не оставляет недописанного файла.
+//
+// Итераторы хранят смещения и остаются действительными при росте файла, а ссылки и указатели
+// на элементы при росте файла (добавлении элементов) становятся недействительными.
+// Один файл может быть открыт только одним объектом списка одновременно.
+// FaultInjection - политика точек отказа для тестов согласованности (см. NoMappedListFaults)
+
+// Точки отказа: моменты, в которые список вызывает политику FaultInjection
+enum class MappedListFaultPoint {
+    Create,        // Заголовок нового файла записан во временный файл, файл ещё не переименован
+    Grow,          // Файл увеличен, но ещё не отображён заново
+    InsertNew,     // Новый узел из нетронутой части файла связан со списком, служебные поля не обновлены
+    InsertReused,  // Узел из списка свободных узлов связан со списком, служебные поля не обновлены
+    Erase,         // Узел исключён из списка, служебные поля не обновлены
+};
+
+// Политика без точек отказа (по умолчанию): вызов пустой и встраивается в ничто
+struct NoMappedListFaults {
+    static void OnFaultPoint(MappedListFaultPoint) noexcept { }
+};
+
+template <typename Type, typename FaultInjection = NoMappedListFaults>
+class MappedSingleLinkedList {
+    static_assert(std::is_trivially_copyable_v<Type>, "elements of a mapped list are stored as raw bytes");
+
+private:
+    // Базовая структура узла списка: смещение следующего узла от начала файла (0 - узла нет)
+    struct NodeBase {
+        uint64_t next_node = 0u;
+    };
+
+    // Структура узла списка
+    struct Node : NodeBase {
+        Type value;
+    };
+
+    // Заголовок файла. Фиктивный узел списка хранится прямо в заголовке
+    struct Header {
+        uint64_t signature;
+        uint32_t element_size;
+        uint32_t node_size;
+        NodeBase head;       // Фиктивный узел
+        uint64_t tail;       // Смещение последнего узла (фиктивного, если список пуст)
+        uint64_t size;       // Размер списка
+        uint64_t free_list;  // Список свободных узлов (связан через next_node)
+        uint64_t bump;       // Смещение первого ни разу не выданного узла
+        uint64_t dirty;      // Ненулевое значение - служебные поля могут быть недостоверны
+    };
+
+    static constexpr uint64_t kSignature = 0x314C4C53'50414D4Dull; // "MMAPSLL1"
+    static constexpr uint64_t kHeadOffset = offsetof(Header, head);
+    static constexpr uint64_t kNodeSize = sizeof(Node);
+    static constexpr uint64_t kDataOffset = (sizeof(Header) + alignof(Node) - 1u) / alignof(Node) * alignof(Node);
+    static constexpr uint64_t kInitialNodes = 64u;
+
+    // Класс итератора/константного итератора (ValueType=Type/const Type) списка
+    template <typename ValueType>
+    class BasicIterator {
+        // Предоставим классу списка доступ к приватным полям и методам
+        friend class MappedSingleLinkedList;
+
+        using ListPointer = std::conditional_t<std::is_const_v<ValueType>, const MappedSingleLinkedList*, MappedSingleLinkedList*>;
+
+    public:
+        // Описание типа итератора
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = ValueType*;
+        using reference = ValueType&;
+
+        // Конструктор по умолчанию
+        BasicIterator() = default;
+
+        // Конструктор копирования (и преобразования неконстантного итератора в константный)
+        BasicIterator(const BasicIterator<Type>& other) noexcept : list_(other.list_), offset_(other.offset_) { }
+
+        // Оператор присваивания
+        BasicIterator& operator = (const BasicIterator& rhs) = default;
+
+        // Операторы сравнения
+        [[nodiscard]] bool operator == (const BasicIterator<Type>& rhs) const noexcept { return offset_ == rhs.offset_; }
+        [[nodiscard]] bool operator != (const BasicIterator<Type>& rhs) const noexcept { return !(*this == rhs); }
+        [[nodiscard]] bool operator == (const BasicIterator<const Type>& rhs) const noexcept { return offset_ == rhs.offset_; }
+        [[nodiscard]] bool operator != (const BasicIterator<const Type>& rhs) const noexcept { return !(*this == rhs); }
+
+        // Преинкремент
+        BasicIterator& operator ++ () noexcept {
+            assert(offset_);
+            offset_ = list_->NodeAt(offset_)->next_node;
+            return *this;
+        }
+
+        // Постинкремент
+        BasicIterator operator ++ (int) noexcept {
+            BasicIterator tmp(*this);
+            ++(*this);
+            return tmp;
+        }
+
+        // Оператор разыменовывания
+        [[nodiscard]] reference operator * () const noexcept {
+            assert(offset_ && offset_ != kHeadOffset);
+            return static_cast<Node*>(list_->NodeAt(offset_))->value;
+        }
+
+        // Оператор доступа к членам
+        [[nodiscard]] pointer operator -> () const noexcept { return &**this; }
+
+    private:
+        ListPointer list_ = nullptr;  // Список, которому принадлежит узел
+        uint64_t offset_ = 0u;        // Смещение узла (0 - конец списка)
+
+        // Конструктор, создающий итератор из смещения узла (используется в классе списка)
+        BasicIterator(ListPointer list, uint64_t offset) noexcept : list_(list), offset_(offset) { }
+
+        template <typename> friend class BasicIterator;
+    };
+
+public:
+    // Псевдонимы для типов, ссылок, константных ссылок, итераторов и константных итераторов
+    using value_type = Type;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+    using Iterator      = BasicIterator<Type>;
+    using ConstIterator = BasicIterator<const Type>;
+
+    // Конструктор: открывает файл path со списком или создаёт пустой список, если файла нет или он пуст.
+    // Ошибки ввода-вывода - std::system_error, файл другого формата - std::runtime_error
+    explicit MappedSingleLinkedList(const std::string& path) {
+        fd_ = ::open(path.c_str(), O_RDWR);
+        if (fd_ < 0 && errno != ENOENT) {
+            ThrowSystemError("open");
+        }
+        try {
+            struct stat file_stat{};
+            if (fd_ >= 0 && ::fstat(fd_, &file_stat) != 0) {
+                ThrowSystemError("fstat");
+            }
+            if (fd_ < 0 || file_stat.st_size == 0) {
+                CreateFile(path);
+            } else {
+                Open(static_cast<uint64_t>(file_stat.st_size));
+            }
+        } catch (...) {
+            Unmap();
+            if (fd_ >= 0) {
+                ::close(fd_);
+            }
+            throw;
+        }
+    }
+
+    MappedSingleLinkedList(const MappedSingleLinkedList&) = delete;
+    MappedSingleLinkedList& operator = (const MappedSingleLinkedList&) = delete;
+
+    // Деструктор закрывает отображение и файл, содержимое списка остаётся в файле
+    ~MappedSingleLinkedList() noexcept {
+        Unmap();
+        ::close(fd_);
+    }
+
+    // Итераторы, указывающие на начало, конец и фиктивный узел списка
+    [[nodiscard]] Iterator begin()        noexcept { return Iterator(this, GetHeader().head.next_node); }
+    [[nodiscard]] Iterator end()          noexcept { return Iterator(this, 0u); }
+    [[nodiscard]] Iterator before_begin() noexcept { return Iterator(this, kHeadOffset); }
+    [[nodiscard]] Iterator before_end()   noexcept { return Iterator(this, GetHeader().tail); }
+
+    // Константные итераторы, указывающие на начало, конец и фиктивный узел списка
+    [[nodiscard]] ConstIterator begin()        const noexcept { return cbegin(); }
+    [[nodiscard]] ConstIterator end()          const noexcept { return cend(); }
+    [[nodiscard]] ConstIterator before_begin() const noexcept { return cbefore_begin(); }
+    [[nodiscard]] ConstIterator before_end()   const noexcept { return cbefore_end(); }
+
+    [[nodiscard]] ConstIterator cbegin()        const noexcept { return ConstIterator(this, GetHeader().head.next_node); }
+    [[nodiscard]] ConstIterator cend()          const noexcept { return ConstIterator(this, 0u); }
+    [[nodiscard]] ConstIterator cbefore_begin() const noexcept { return ConstIterator(this, kHeadOffset); }
+    [[nodiscard]] ConstIterator cbefore_end()   const noexcept { return ConstIterator(this, GetHeader().tail); }
+
+    // Функция получения размера
+    [[nodiscard]] size_t GetSize() const noexcept { return static_cast<size_t>(GetHeader().size); }
+
+    // Функция проверки на пустоту
+    [[nodiscard]] bool IsEmpty() const noexcept { return GetHeader().size == 0u; }
+
+    // Функция проверки того, что при открытии файла служебные поля восстанавливались после аварийного завершения
+    [[nodiscard]] bool WasRecovered() const noexcept { return recovered_; }
+
+
+    // Функции доступа к первому и последнему элементам списка
+    [[nodiscard]] reference       front()       noexcept { assert(!IsEmpty()); return *begin(); }
+    [[nodiscard]] const_reference front() const noexcept { assert(!IsEmpty()); return *cbegin(); }
+    [[nodiscard]] reference       back()        noexcept { assert(!IsEmpty()); return *before_end(); }
+    [[nodiscard]] const_reference back()  const noexcept { assert(!IsEmpty()); return *cbefore_end(); }
+
+    // Функции добавления в начало и в конец списка
+    void PushFront(const Type& value) { InsertAfter(cbefore_begin(), value); }
+    void PushBack(const Type& value) { InsertAfter(cbefore_end(), value); }
+
+    // Функция удаления из начала списка
+    void PopFront() noexcept {
+        assert(!IsEmpty());
+        EraseAfter(cbefore_begin());
+    }
+
+    // Функция добавления после элемента, на который указывает итератор
+    Iterator InsertAfter(ConstIterator pos, const Type& value) {
+        assert(pos.list_ == this && pos.offset_);
+
+        // Узел резервируется до начала операции: рост файла может переотобразить память
+        // (value тоже может лежать в файле, поэтому копируется заранее)
+        const Type value_copy = value;
+        const uint64_t slot = ReserveSlot();
+        BeginUpdate();
+
+        Header& header = GetHeader();
+        Node* node = static_cast<Node*>(NodeAt(slot));
+        const bool from_free_list = slot == header.free_list;
+        const uint64_t free_next = from_free_list ? node->next_node : 0u;
+
+        std::memcpy(&node->value, &value_copy, sizeof(Type));
+        node->next_node = NodeAt(pos.offset_)->next_node;
+        Publish(NodeAt(pos.offset_)->next_node, slot);
+        FaultInjection::OnFaultPoint(from_free_list ? MappedListFaultPoint::InsertReused : MappedListFaultPoint::InsertNew);
+
+        if (from_free_list) {
+            header.free_list = free_next;
+        } else {
+            header.bump += kNodeSize;
+        }
+        if (header.tail == pos.offset_) header.tail = slot;
+        ++header.size;
+
+        EndUpdate();
+        return Iterator(this, slot);
+    }
+
+    // Функция удаления после элемента, на который указывает итератор
+    Iterator EraseAfter(ConstIterator pos) noexcept {
+        assert(pos.list_ == this && pos.offset_);
+        NodeBase* prev = NodeAt(pos.offset_);
+        const uint64_t victim = prev->next_node;
+        assert(victim);
+
+        BeginUpdate();
+        Header& header = GetHeader();
+        NodeBase* node = NodeAt(victim);
+        const uint64_t next = node->next_node;
+        Publish(prev->next_node, next);
+        FaultInjection::OnFaultPoint(MappedListFaultPoint::Erase);
+
+        if (header.tail == victim) header.tail = pos.offset_;
+        --header.size;
+        node->next_node = header.free_list;
+        header.free_list = victim;
+
+        EndUpdate();
+        return Iterator(this, next);
+    }
+
+    // Очистка списка. Все узлы файла становятся свободными, размер файла не меняется
+    void Clear() noexcept {
+        BeginUpdate();
+        Header& header = GetHeader();
+        Publish(header.head.next_node, 0u);
+        header.tail = kHeadOffset;
+        header.size = 0u;
+        header.free_list = 0u;
+        header.bump = kDataOffset;
+        EndUpdate();
+    }
+
+    // Сброс изменённых страниц файла на диск
+    void Sync() {
+        if (::msync(base_, mapped_size_, MS_SYNC) != 0) {
+            ThrowSystemError("msync");
+        }
+    }
+
+private:
+    int fd_ = -1;                  // Дескриптор файла
+    std::byte* base_ = nullptr;    // Начало отображения
+    uint64_t mapped_size_ = 0u;    // Размер отображения (равен размеру файла)
+    bool recovered_ = false;       // При открытии выполнялось восстановление
+
+    // Функции доступа к заголовку и узлам по смещению
+    Header& GetHeader() noexcept { return *reinterpret_cast<Header*>(base_); }
+    const Header& GetHeader() const noexcept { return *reinterpret_cast<const Header*>(base_); }
+
+    NodeBase* NodeAt(uint64_t offset) const noexcept {
+        assert(offset && offset + sizeof(NodeBase) <= mapped_size_);
+        return reinterpret_cast<NodeBase*>(base_ + offset);
+    }
+
+    // Запись смещения, публикующая узел: все предыдущие записи в узел выполняются раньше неё
+    static void Publish(uint64_t& link, uint64_t offset) noexcept {
+        std::atomic_signal_fence(std::memory_order_release);
+        link = offset;
+        std::atomic_signal_fence(std::memory_order_release);
+    }
+
+    // Пометка служебных полей как ненадёжных на время операции и снятие пометки
+    void BeginUpdate() noexcept { Publish(GetHeader().dirty, 1u); }
+    void EndUpdate() noexcept { Publish(GetHeader().dirty, 0u); }
+
+    // Смещение узла, который займёт следующий добавленный элемент (файл при необходимости растёт)
+    uint64_t ReserveSlot() {
+        const Header& header = GetHeader();
+        if (header.free_list) {
+            return header.free_list;
+        }
+        if (header.bump + kNodeSize > mapped_size_) {
+            Grow(mapped_size_ + (mapped_size_ - kDataOffset));
+        }
+        return GetHeader().bump;
+    }
+
+    // Создание файла path с пустым списком: список создаётся во временном файле, который затем
+    // переименовывается в path (переименование атомарно и заменяет пустой файл, если он был)
+    void CreateFile(const std::string& path) {
+        if (fd_ >= 0) {
+            ::close(fd_);
+        }
+        const std::string temp_path = path + ".tmp";
+        fd_ = ::open(temp_path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fd_ < 0) {
+            ThrowSystemError("open");
+        }
+        Create();
+        FaultInjection::OnFaultPoint(MappedListFaultPoint::Create);
+        if (::rename(temp_path.c_str(), path.c_str()) != 0) {
+            const int error = errno;
+            ::unlink(temp_path.c_str());
+            errno = error;
+            ThrowSystemError("rename");
+        }
+    }
+
+    // Создание пустого списка в новом файле
+    void Create() {
+        Grow(kDataOffset + kInitialNodes * kNodeSize);
+        Header& header = GetHeader();
+        header.element_size = sizeof(Type);
+        header.node_size = kNodeSize;
+        header.head.next_node = 0u;
+        header.tail = kHeadOffset;
+        header.size = 0u;
+        header.free_list = 0u;
+        header.bump = kDataOffset;
+        header.dirty = 0u;
+        Publish(header.signature, kSignature);
+    }
+
+    // Открытие существующего файла. Если процесс завершился посреди операции, служебные поля восстанавливаются
+    void Open(uint64_t file_size) {
+        if (file_size < kDataOffset) {
+            throw std::runtime_error("invalid mapped list file");
+        }
+        Map(file_size);
+        const Header& header = GetHeader();
+        if (header.signature != kSignature || header.element_size != sizeof(Type) || header.node_size != kNodeSize) {
+            throw std::runtime_error("invalid mapped list file");
+        }
+        if (header.dirty) {
+            Recover();
+        }
+    }
+
+    // Восстановление размера, последнего узла и списка свободных узлов проходом по списку
+    void Recover() {
+        Header& header = GetHeader();
+        const uint64_t slots = (mapped_size_ - kDataOffset) / kNodeSize;
+        std::vector<bool> reachable(slots, false);
+
+        uint64_t size = 0u;
+        uint64_t tail = kHeadOffset;
+        uint64_t bump = std::min(std::max(header.bump, kDataOffset), kDataOffset + slots * kNodeSize);
+        for (uint64_t offset = header.head.next_node; offset; offset = NodeAt(offset)->next_node) {
+            if (offset < kDataOffset || (offset - kDataOffset) % kNodeSize != 0u || offset + kNodeSize > mapped_size_
+                || reachable[(offset - kDataOffset) / kNodeSize]) {
+                throw std::runtime_error("corrupted mapped list file");
+            }
+            reachable[(offset - kDataOffset) / kNodeSize] = true;
+            bump = std::max(bump, offset + kNodeSize);
+            tail = offset;
+            ++size;
+        }
+
+        uint64_t free_list = 0u;
+        for (uint64_t offset = kDataOffset; offset < bump; offset += kNodeSize) {
+            if (!reachable[(offset - kDataOffset) / kNodeSize]) {
+                NodeAt(offset)->next_node = free_list;
+                free_list = offset;
+            }
+        }
+
+        header.tail = tail;
+        header.size = size;
+        header.free_list = free_list;
+        header.bump = bump;
+        EndUpdate();
+        recovered_ = true;
+    }
+
+    // Увеличение файла до new_size байт и повторное отображение. Если отобразить файл не удалось,
+    // старое отображение остаётся, и список не меняется (лишний размер файла не используется)
+    void Grow(uint64_t new_size) {
+        if (::ftruncate(fd_, static_cast<off_t>(new_size)) != 0) {
+            ThrowSystemError("ftruncate");
+        }
+        FaultInjection::OnFaultPoint(MappedListFaultPoint::Grow);
+        Map(new_size);
+    }
+
+    // Отображение size байт файла. Прежнее отображение снимается только после успешного mmap
+    void Map(uint64_t size) {
+        void* base = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+        if (base == MAP_FAILED) {
+            ThrowSystemError("mmap");
+        }
+        Unmap();
+        base_ = static_cast<std::byte*>(base);
+        mapped_size_ = size;
+    }
+
+    void Unmap() noexcept {
+        if (base_) {
+            ::munmap(base_, mapped_size_);
+            base_ = nullptr;
+            mapped_size_ = 0u;
+        }
+    }
+
+    [[noreturn]] static void ThrowSystemError(const char* what) {
+        throw std::system_error(errno, std::generic_category(), what);
+    }
+};
+
+// Операторы сравнения списков "==" и "<"
+template <typename Type, typename FaultInjection>
+bool operator == (const MappedSingleLinkedList<Type, FaultInjection>& lhs, const MappedSingleLinkedList<Type, FaultInjection>& rhs) {
+    return std::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend());
+}
+
+template <typename Type, typename FaultInjection>
+bool operator < (const MappedSingleLinkedList<Type, FaultInjection>& lhs, const MappedSingleLinkedList<Type, FaultInjection>& rhs) {
+    return std::lexicographical_compare(lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend());
+}
+
+// Производные от "==" и "<" операторы сравнения списков
+template <typename Type, typename FaultInjection>
+bool operator != (const MappedSingleLinkedList<Type, FaultInjection>& lhs, const MappedSingleLinkedList<Type, FaultInjection>& rhs) { return !(lhs == rhs); }
+
+template <typename Type, typename FaultInjection>
+bool operator >  (const MappedSingleLinkedList<Type, FaultInjection>& lhs, const MappedSingleLinkedList<Type, FaultInjection>& rhs) { return rhs < lhs; }
+
+template <typename Type, typename FaultInjection>
+bool operator <= (const MappedSingleLinkedList<Type, FaultInjection>& lhs, const MappedSingleLinkedList<Type, FaultInjection>& rhs) { return !(rhs < lhs); }
+
+template <typename Type, typename FaultInjection>
+bool operator >= (const MappedSingleLinkedList<Type, FaultInjection>& lhs, const MappedSingleLinkedList<Type, FaultInjection>& rhs) { return !(lhs < rhs); }
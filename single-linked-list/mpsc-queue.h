@@ -0,0 +1,170 @@
+#pragma once
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <utility>
+
+#include "single-linked-list.h"
+
+// Очередь "много производителей - один потребитель" на узлах SingleLinkedList (очередь Вьюкова).
+// Производитель создаёт узел и публикует его одним атомарным обменом указателя на последний узел,
+// после чего записывает связь предыдущего узла с новым. Потребитель забирает разом всю накопленную
+// цепочку узлов и отдаёт её как SingleLinkedList: узлы переходят в список без копирования элементов.
+// Необязательная граница capacity ограничивает количество элементов в очереди (обратное давление)
+// ценой ещё одной атомарной операции на элемент.
+// Аллокатор узлов вызывается из потоков производителей одновременно и должен быть потокобезопасным
+// (NodePoolAllocator не подходит)
+template <typename Type, typename Allocator = std::allocator<Type>>
+class MpscQueue {
+public:
+    using List = SingleLinkedList<Type, Allocator>;
+
+private:
+    using NodeLink = typename List::NodeLink;
+
+public:
+    // Конструктор: capacity - наибольшее количество элементов в очереди (0 - без ограничения)
+    explicit MpscQueue(size_t capacity = 0u, const Allocator& alloc = Allocator())
+        : capacity_(capacity), alloc_(alloc) { }
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator = (const MpscQueue&) = delete;
+
+    // Деструктор разрушает элементы, оставшиеся в очереди (производители к этому времени должны завершиться)
+    ~MpscQueue() noexcept {
+        List remaining(alloc_);
+        DrainInto(remaining);
+    }
+
+    // Функция добавления элемента в очередь (вызывается из любого потока). Если очередь ограничена
+    // и заполнена, ждёт, пока потребитель не заберёт элементы
+    void Push(const Type& value) { Emplace(value); }
+    void Push(Type&& value) { Emplace(std::move(value)); }
+
+    // Функция создания элемента в очереди из аргументов конструктора Type
+    template <typename... Args>
+    void Emplace(Args&&... args) {
+        if (capacity_ != 0u) {
+            while (!TryReserve()) {
+                std::this_thread::yield();
+            }
+        }
+        Publish(CreateReservedNode(std::forward<Args>(args)...));
+    }
+
+    // Функция добавления элемента без ожидания. Возвращает false, если ограниченная очередь заполнена
+    bool TryPush(const Type& value) { return TryEmplace(value); }
+    bool TryPush(Type&& value) { return TryEmplace(std::move(value)); }
+
+    template <typename... Args>
+    bool TryEmplace(Args&&... args) {
+        if (capacity_ != 0u && !TryReserve()) {
+            return false;
+        }
+        Publish(CreateReservedNode(std::forward<Args>(args)...));
+        return true;
+    }
+
+    // Функция получения всех накопленных элементов в порядке добавления (вызывается только потребителем).
+    // Узлы переходят в список без копирования. Если производитель опубликовал узел, но ещё не связал его
+    // с предыдущим, потребитель дожидается связи (это короткое окно между двумя инструкциями производителя)
+    [[nodiscard]] List Drain() {
+        List batch(alloc_);
+        DrainInto(batch);
+        return batch;
+    }
+
+    // Функция добавления всех накопленных элементов в конец списка list за O(размер пачки)
+    void DrainInto(List& list) noexcept {
+        assert(list.get_allocator() == alloc_);
+        if (tail_.load(std::memory_order_acquire) == &stub_) {
+            return;
+        }
+
+        // Первый узел: его связь со stub_ записывает производитель, первым сменивший stub_ в tail_
+        NodeLink* first = WaitLink(&stub_);
+        StoreLink(&stub_, nullptr);
+
+        // Отрезаем цепочку: следующие производители будут связывать свои узлы со stub_
+        NodeLink* last = tail_.exchange(&stub_, std::memory_order_acq_rel);
+        size_t count = 1u;
+        for (NodeLink* node = first; node != last; node = WaitLink(node)) {
+            ++count;
+        }
+
+        list.AdoptChainAfter(list.cbefore_end(), first, last, count);
+        if (capacity_ != 0u) {
+            size_.fetch_sub(count, std::memory_order_release);
+        }
+    }
+
+    // Функция проверки на пустоту (результат может устареть сразу после вызова)
+    [[nodiscard]] bool IsEmpty() const noexcept { return tail_.load(std::memory_order_acquire) == &stub_; }
+
+    // Функция получения границы количества элементов (0 - без ограничения)
+    [[nodiscard]] size_t GetCapacity() const noexcept { return capacity_; }
+
+private:
+    NodeLink stub_;                                    // Фиктивный узел: начало цепочки ожидающих узлов
+    alignas(64) std::atomic<NodeLink*> tail_{ &stub_ }; // Последний опубликованный узел (изменяют производители)
+    alignas(64) std::atomic<size_t> size_{ 0u };       // Элементов в очереди (только для ограниченной очереди)
+    const size_t capacity_;
+    Allocator alloc_;
+
+    // Функция резервирования места в ограниченной очереди
+    bool TryReserve() noexcept {
+        if (size_.fetch_add(1u, std::memory_order_acquire) < capacity_) {
+            return true;
+        }
+        size_.fetch_sub(1u, std::memory_order_relaxed);
+        return false;
+    }
+
+    // Функция создания узла под уже зарезервированное место. Если создание выбросило исключение,
+    // место в ограниченной очереди освобождается
+    template <typename... Args>
+    NodeLink* CreateReservedNode(Args&&... args) {
+        try {
+            return List::CreateDetachedNode(alloc_, std::forward<Args>(args)...);
+        } catch (...) {
+            if (capacity_ != 0u) size_.fetch_sub(1u, std::memory_order_relaxed);
+            throw;
+        }
+    }
+
+    // Функция публикации узла: обмен указателя на последний узел и связь предыдущего узла с новым
+    void Publish(NodeLink* node) noexcept {
+        NodeLink* prev = tail_.exchange(node, std::memory_order_acq_rel);
+        StoreLink(prev, node);
+    }
+
+    // Функции атомарного доступа к обычной связи узла SingleLinkedList: связь записывает производитель,
+    // а читает потребитель
+    static void StoreLink(NodeLink* node, NodeLink* next) noexcept {
+#if defined(__cpp_lib_atomic_ref)
+        std::atomic_ref<NodeLink*>(node->next_node).store(next, std::memory_order_release);
+#else
+        __atomic_store_n(&node->next_node, next, __ATOMIC_RELEASE);
+#endif
+    }
+
+    static NodeLink* LoadLink(NodeLink* node) noexcept {
+#if defined(__cpp_lib_atomic_ref)
+        return std::atomic_ref<NodeLink*>(node->next_node).load(std::memory_order_acquire);
+#else
+        return __atomic_load_n(&node->next_node, __ATOMIC_ACQUIRE);
+#endif
+    }
+
+    // Функция ожидания связи узла, который уже сменил другой узел в tail_
+    static NodeLink* WaitLink(NodeLink* node) noexcept {
+        NodeLink* next = LoadLink(node);
+        while (!next) {
+            std::this_thread::yield();
+            next = LoadLink(node);
+        }
+        return next;
+    }
+};
@@ -0,0 +1,232 @@
+#pragma once
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+// Пул узлов: выдаёт блоки одинакового размера из непрерывных кусков памяти (чанков)
+// и хранит освобождённые блоки в списке свободных блоков
+class NodePool {
+public:
+    // Конструктор: задаёт количество блоков в первом чанке (следующие чанки растут вдвое)
+    explicit NodePool(size_t first_chunk_slots = 64u) noexcept
+        : next_chunk_slots_(first_chunk_slots > 0u ? first_chunk_slots : 1u) { }
+
+    NodePool(const NodePool&) = delete;
+    NodePool& operator = (const NodePool&) = delete;
+
+    // Деструктор возвращает все чанки в систему
+    ~NodePool() noexcept {
+        for (const Chunk& chunk : chunks_) {
+            ::operator delete(chunk.begin, std::align_val_t(slot_align_));
+        }
+    }
+
+    // Выдача одного блока размером size с выравниванием align. Размер блока фиксируется при первом вызове
+    void* Allocate(size_t size, size_t align) {
+        SetSlotLayout(size, align);
+
+        ++live_count_;
+        if (free_list_) {
+            FreeSlot* slot = free_list_;
+            free_list_ = slot->next;
+            return slot;
+        }
+        if (bump_ == bump_end_) {
+            try {
+                NextChunk();
+            } catch (...) {
+                --live_count_;
+                throw;
+            }
+        }
+        void* slot = bump_;
+        bump_ += slot_size_;
+        return slot;
+    }
+
+    // Резервирование count блоков подряд: если список свободных блоков пуст, следующие count вызовов
+    // Allocate выдадут блоки в порядке возрастания адресов без перехода к новому чанку посередине.
+    // Остаток текущего чанка, которого не хватает, переходит в список свободных блоков так, чтобы
+    // выдаваться первым и тоже по возрастанию адресов
+    void Reserve(size_t size, size_t align, size_t count) {
+        SetSlotLayout(size, align);
+        const size_t available = static_cast<size_t>(bump_end_ - bump_) / slot_size_;
+        if (free_list_ || available >= count || current_chunk_ + 1u < chunks_.size()) {
+            return;
+        }
+
+        const size_t chunk_slots = next_chunk_slots_;
+        next_chunk_slots_ = count - available > next_chunk_slots_ ? count - available : next_chunk_slots_;
+        std::byte* const rest_begin = bump_;
+        std::byte* rest_end = bump_end_;
+        try {
+            NextChunk();
+        } catch (...) {
+            next_chunk_slots_ = chunk_slots;
+            throw;
+        }
+        while (rest_end != rest_begin) {
+            rest_end -= slot_size_;
+            free_list_ = ::new (static_cast<void*>(rest_end)) FreeSlot{ free_list_ };
+        }
+    }
+
+    // Возврат блока в список свободных блоков
+    void Deallocate(void* ptr) noexcept {
+        assert(ptr);
+        assert(live_count_ > 0u);
+
+        free_list_ = ::new (ptr) FreeSlot{ free_list_ };
+        --live_count_;
+    }
+
+    // Освобождение разом всех выданных блоков. Чанки остаются у пула для повторного использования.
+    // Объекты в блоках не разрушаются: вызывающая сторона должна гарантировать, что это не требуется
+    void ReleaseAll() noexcept {
+        free_list_ = nullptr;
+        live_count_ = 0u;
+        current_chunk_ = 0u;
+        if (chunks_.empty()) {
+            bump_ = bump_end_ = nullptr;
+        } else {
+            bump_ = chunks_.front().begin;
+            bump_end_ = chunks_.front().end;
+        }
+    }
+
+    // Количество выданных и ещё не возвращённых блоков
+    [[nodiscard]] size_t GetLiveCount() const noexcept { return live_count_; }
+
+    // Размер одного блока (0, пока пул не выдал ни одного блока)
+    [[nodiscard]] size_t GetSlotSize() const noexcept { return slot_size_; }
+
+private:
+    // Свободный блок хранит указатель на следующий свободный блок
+    struct FreeSlot {
+        FreeSlot* next = nullptr;
+    };
+
+    // Чанк памяти [begin; end)
+    struct Chunk {
+        std::byte* begin = nullptr;
+        std::byte* end = nullptr;
+    };
+
+    // Фиксация размера и выравнивания блока при первом обращении и проверка запроса на совпадение с ними
+    void SetSlotLayout(size_t size, size_t align) {
+        if (slot_size_ == 0u) {
+            slot_align_ = align > alignof(FreeSlot) ? align : alignof(FreeSlot);
+            slot_size_ = (size > sizeof(FreeSlot) ? size : sizeof(FreeSlot));
+            slot_size_ = (slot_size_ + slot_align_ - 1u) / slot_align_ * slot_align_;
+        }
+        if (size > slot_size_ || align > slot_align_) {
+            throw std::bad_alloc();
+        }
+    }
+
+    // Переход к следующему чанку: уже выделенному (после ReleaseAll) или новому
+    void NextChunk() {
+        if (!chunks_.empty() && current_chunk_ + 1u < chunks_.size()) {
+            ++current_chunk_;
+        } else {
+            const size_t bytes = next_chunk_slots_ * slot_size_;
+            chunks_.reserve(chunks_.size() + 1u);
+            auto* begin = static_cast<std::byte*>(::operator new(bytes, std::align_val_t(slot_align_)));
+            chunks_.push_back({ begin, begin + bytes });
+            current_chunk_ = chunks_.size() - 1u;
+            next_chunk_slots_ *= 2u;
+        }
+        bump_ = chunks_[current_chunk_].begin;
+        bump_end_ = chunks_[current_chunk_].end;
+    }
+
+    std::vector<Chunk> chunks_;      // Все чанки пула
+    size_t current_chunk_ = 0u;      // Чанк, из которого сейчас выдаются новые блоки
+    size_t next_chunk_slots_;        // Количество блоков в следующем новом чанке
+    std::byte* bump_ = nullptr;      // Начало невыданной части текущего чанка
+    std::byte* bump_end_ = nullptr;  // Конец текущего чанка
+    FreeSlot* free_list_ = nullptr;  // Список свободных блоков
+    size_t slot_size_ = 0u;          // Размер блока
+    size_t slot_align_ = alignof(std::max_align_t); // Выравнивание блока
+    size_t live_count_ = 0u;         // Количество выданных блоков
+};
+
+// Аллокатор (совместимый с std::allocator_traits), выдающий одиночные объекты из общего пула NodePool.
+// Копии аллокатора разделяют пул; копия списка получает новый пул (select_on_container_copy_construction)
+template <typename Type>
+class NodePoolAllocator {
+    // Аллокаторы с другим value_type (после rebind) разделяют тот же пул
+    template <typename> friend class NodePoolAllocator;
+
+public:
+    using value_type = Type;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    using is_always_equal = std::false_type;
+
+    // Конструктор по умолчанию создаёт новый пул
+    NodePoolAllocator() : pool_(std::make_shared<NodePool>()) { }
+
+    // Конструктор, использующий заданный пул
+    explicit NodePoolAllocator(std::shared_ptr<NodePool> pool) noexcept : pool_(std::move(pool)) {
+        assert(pool_);
+    }
+
+    // Конструктор копирования (перемещение аллокатора обязано оставлять исходный аллокатор неизменным,
+    // поэтому отдельного конструктора перемещения нет)
+    NodePoolAllocator(const NodePoolAllocator& other) noexcept = default;
+
+    // Конструктор копирования из аллокатора с другим value_type
+    template <typename Other>
+    NodePoolAllocator(const NodePoolAllocator<Other>& other) noexcept : pool_(other.pool_) { }
+
+    NodePoolAllocator& operator = (const NodePoolAllocator& rhs) noexcept = default;
+
+    // Выделение памяти под n объектов: одиночные объекты берутся из пула, массивы - из общей кучи
+    [[nodiscard]] Type* allocate(size_t n) {
+        if (n == 1u) {
+            return static_cast<Type*>(pool_->Allocate(sizeof(Type), alignof(Type)));
+        }
+        return std::allocator<Type>().allocate(n);
+    }
+
+    // Освобождение памяти, выделенной allocate(n)
+    void deallocate(Type* ptr, size_t n) noexcept {
+        if (n == 1u) {
+            pool_->Deallocate(ptr);
+        } else {
+            std::allocator<Type>().deallocate(ptr, n);
+        }
+    }
+
+    // Копия контейнера получает собственный пул
+    [[nodiscard]] NodePoolAllocator select_on_container_copy_construction() const {
+        return NodePoolAllocator();
+    }
+
+    // Проверка того, что все выданные пулом блоки принадлежат контейнеру из live_count узлов
+    [[nodiscard]] bool CanReleaseAll(size_t live_count) const noexcept {
+        return pool_->GetLiveCount() == live_count;
+    }
+
+    // Резервирование n блоков подряд (см. NodePool::Reserve)
+    void Reserve(size_t n) { pool_->Reserve(sizeof(Type), alignof(Type), n); }
+
+    // Освобождение разом всех блоков пула (см. NodePool::ReleaseAll)
+    void ReleaseAll() noexcept { pool_->ReleaseAll(); }
+
+    // Пул аллокатора
+    [[nodiscard]] const std::shared_ptr<NodePool>& GetPool() const noexcept { return pool_; }
+
+    template <typename Other>
+    [[nodiscard]] bool operator == (const NodePoolAllocator<Other>& rhs) const noexcept { return pool_ == rhs.pool_; }
+    template <typename Other>
+    [[nodiscard]] bool operator != (const NodePoolAllocator<Other>& rhs) const noexcept { return !(*this == rhs); }
+
+private:
+    std::shared_ptr<NodePool> pool_; // Разделяемый пул
+};
\ No newline at end of file
@@ -0,0 +1,316 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+// Класс персистентного (неизменяемого) односвязного списка со структурным разделением узлов.
+// Узлы неизменяемы и считают ссылки на себя: копия списка разделяет все узлы оригинала и создаётся за O(1),
+// PushFront добавляет новый узел перед разделяемым хвостом, PopFront переходит к хвосту - тоже за O(1),
+// а остальные копии при этом не меняются. Счётчики ссылок атомарные, поэтому копии одного списка
+// можно передавать в разные потоки и менять там независимо (один объект списка, как и std::shared_ptr,
+// не предназначен для одновременного изменения из нескольких потоков).
+// Узел освобождает последний ссылающийся на него список его копией аллокатора: аллокатор должен
+// быть потокобезопасным, а его копии - взаимозаменяемыми (NodePoolAllocator не подходит)
+template <typename Type, typename Allocator = std::allocator<Type>>
+class PersistentSingleLinkedList {
+private:
+    // Структура узла: счётчик ссылок (списков и предыдущих узлов), связь со следующим узлом и значение
+    struct Node {
+        template <typename... Args>
+        explicit Node(Node* next, Args&&... args) : next_node(next), value(std::forward<Args>(args)...) { }
+
+        std::atomic<size_t> ref_count{ 1u };
+        Node* next_node;   // Меняется только при построении списка, пока узел никому не виден
+        const Type value;
+    };
+
+    // Аллокатор узлов и его свойства
+    using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using NodeAllocTraits = std::allocator_traits<NodeAllocator>;
+
+public:
+    // Класс константного итератора списка (элементы персистентного списка не изменяются)
+    class ConstIterator {
+        // Предоставим классу списка доступ к приватным полям и методам
+        friend class PersistentSingleLinkedList;
+
+    public:
+        // Описание типа итератора
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Type*;
+        using reference = const Type&;
+
+        ConstIterator() = default;
+
+        [[nodiscard]] bool operator == (const ConstIterator& rhs) const noexcept { return node_ == rhs.node_; }
+        [[nodiscard]] bool operator != (const ConstIterator& rhs) const noexcept { return !(*this == rhs); }
+
+        // Преинкремент
+        ConstIterator& operator ++ () noexcept {
+            assert(node_);
+            node_ = node_->next_node;
+            return *this;
+        }
+
+        // Постинкремент
+        ConstIterator operator ++ (int) noexcept {
+            ConstIterator tmp(*this);
+            ++(*this);
+            return tmp;
+        }
+
+        // Оператор разыменовывания
+        [[nodiscard]] reference operator * () const noexcept {
+            assert(node_);
+            return node_->value;
+        }
+
+        // Оператор доступа к членам
+        [[nodiscard]] pointer operator -> () const noexcept {
+            assert(node_);
+            return &node_->value;
+        }
+
+    private:
+        // Указатель на узел
+        const Node* node_ = nullptr;
+
+        // Конструктор, создающий итератор из указателя на узел (используется в классе списка)
+        explicit ConstIterator(const Node* node) noexcept : node_(node) { }
+    };
+
+    // Псевдонимы для типов, ссылок и итераторов
+    using value_type = Type;
+    using allocator_type = Allocator;
+    using const_reference = const value_type&;
+    using Iterator = ConstIterator;
+
+    // Конструктор по умолчанию создаёт пустой список
+    PersistentSingleLinkedList() noexcept(std::is_nothrow_default_constructible_v<NodeAllocator>) = default;
+
+    // Конструктор, создающий пустой список с заданным аллокатором
+    explicit PersistentSingleLinkedList(const Allocator& alloc) noexcept : node_alloc_(alloc) { }
+
+    // Конструктор, создающий список из элементов std::initializer_list
+    PersistentSingleLinkedList(std::initializer_list<Type> values, const Allocator& alloc = Allocator())
+        : PersistentSingleLinkedList(values.begin(), values.end(), alloc) { }
+
+    // Конструктор, создающий список из элементов интервала [first; last) за один проход
+    template <typename InputIterator, typename = std::enable_if_t<std::is_convertible_v<
+        typename std::iterator_traits<InputIterator>::iterator_category, std::input_iterator_tag>>>
+    PersistentSingleLinkedList(InputIterator first, InputIterator last, const Allocator& alloc = Allocator())
+        : node_alloc_(alloc) {
+        Node** link = &head_;
+        try {
+            for (; first != last; ++first) {
+                *link = CreateNode(nullptr, *first);
+                link = &(*link)->next_node;
+                ++size_;
+            }
+        } catch (...) {
+            Clear();
+            throw;
+        }
+    }
+
+    // Конструктор копирования за O(1): копия разделяет все узлы оригинала
+    PersistentSingleLinkedList(const PersistentSingleLinkedList& other) noexcept
+        : head_(AddRef(other.head_)), size_(other.size_), node_alloc_(other.node_alloc_) { }
+
+    // Конструктор перемещения
+    PersistentSingleLinkedList(PersistentSingleLinkedList&& other) noexcept
+        : head_(std::exchange(other.head_, nullptr)), size_(std::exchange(other.size_, 0u)), node_alloc_(other.node_alloc_) { }
+
+    // Деструктор освобождает узлы, на которые больше никто не ссылается
+    ~PersistentSingleLinkedList() noexcept { Clear(); }
+
+    // Оператор присваивания за O(1)
+    PersistentSingleLinkedList& operator = (const PersistentSingleLinkedList& rhs) noexcept {
+        if (this != &rhs) {
+            PersistentSingleLinkedList rhs_copy(rhs);
+            swap(rhs_copy);
+        }
+        return *this;
+    }
+
+    // Оператор перемещающего присваивания
+    PersistentSingleLinkedList& operator = (PersistentSingleLinkedList&& rhs) noexcept {
+        if (this != &rhs) {
+            PersistentSingleLinkedList rhs_moved(std::move(rhs));
+            swap(rhs_moved);
+        }
+        return *this;
+    }
+
+    // Итераторы, указывающие на начало и конец списка
+    [[nodiscard]] ConstIterator begin()  const noexcept { return ConstIterator(head_); }
+    [[nodiscard]] ConstIterator end()    const noexcept { return ConstIterator(nullptr); }
+    [[nodiscard]] ConstIterator cbegin() const noexcept { return begin(); }
+    [[nodiscard]] ConstIterator cend()   const noexcept { return end(); }
+
+    // Функция обмена с другим списком
+    void swap(PersistentSingleLinkedList& other) noexcept {
+        using std::swap;
+        swap(head_, other.head_);
+        swap(size_, other.size_);
+        swap(node_alloc_, other.node_alloc_);
+    }
+
+    // Функция получения копии аллокатора
+    [[nodiscard]] allocator_type get_allocator() const noexcept { return allocator_type(node_alloc_); }
+
+    // Функция получения размера
+    [[nodiscard]] size_t GetSize() const noexcept { return size_; }
+
+    // Функция проверки на пустоту
+    [[nodiscard]] bool IsEmpty() const noexcept { return size_ == 0u; }
+
+    // Функция проверки того, что списки разделяют все узлы (один список получен копированием другого
+    // и после этого не менялся)
+    [[nodiscard]] bool SharesNodesWith(const PersistentSingleLinkedList& other) const noexcept {
+        return head_ == other.head_;
+    }
+
+    // Функция доступа к первому элементу списка
+    [[nodiscard]] const_reference front() const noexcept {
+        assert(!IsEmpty());
+        return head_->value;
+    }
+
+    // Функция добавления в начало списка за O(1). Хвост остаётся общим с копиями списка
+    void PushFront(const Type& value) { EmplaceFront(value); }
+    void PushFront(Type&& value) { EmplaceFront(std::move(value)); }
+
+    // Функция создания элемента в начале списка из аргументов конструктора Type
+    template <typename... Args>
+    const_reference EmplaceFront(Args&&... args) {
+        // Ссылка списка на старую голову переходит к новому узлу
+        Node* node = CreateNode(head_, std::forward<Args>(args)...);
+        head_ = node;
+        ++size_;
+        return node->value;
+    }
+
+    // Функция удаления из начала списка за O(1): список переходит к хвосту (копии не меняются)
+    void PopFront() noexcept {
+        assert(!IsEmpty());
+
+        Node* old_head = head_;
+        head_ = AddRef(old_head->next_node);
+        --size_;
+        Release(old_head);
+    }
+
+    // Функция получения хвоста списка (списка без первого элемента) за O(1)
+    [[nodiscard]] PersistentSingleLinkedList GetTail() const noexcept {
+        assert(!IsEmpty());
+
+        PersistentSingleLinkedList tail(node_alloc_);
+        tail.head_ = AddRef(head_->next_node);
+        tail.size_ = size_ - 1u;
+        return tail;
+    }
+
+    // Очистка списка: узлы, на которые больше никто не ссылается, освобождаются
+    void Clear() noexcept {
+        Release(std::exchange(head_, nullptr));
+        size_ = 0u;
+    }
+
+private:
+    Node* head_ = nullptr;      // Первый узел (своя ссылка списка)
+    size_t size_ = 0u;          // Размер списка
+    NodeAllocator node_alloc_;  // Аллокатор узлов
+
+    // Функция создания узла через аллокатор
+    template <typename... Args>
+    Node* CreateNode(Node* next, Args&&... args) {
+        Node* node = NodeAllocTraits::allocate(node_alloc_, 1u);
+        try {
+            NodeAllocTraits::construct(node_alloc_, node, next, std::forward<Args>(args)...);
+        } catch (...) {
+            NodeAllocTraits::deallocate(node_alloc_, node, 1u);
+            throw;
+        }
+        return node;
+    }
+
+    // Функция добавления ссылки на узел. Новая ссылка создаётся из уже существующей, поэтому
+    // упорядочивание памяти не требуется
+    static Node* AddRef(Node* node) noexcept {
+        if (node) {
+            node->ref_count.fetch_add(1u, std::memory_order_relaxed);
+        }
+        return node;
+    }
+
+    // Функция снятия ссылки на узел. Освобождение последней ссылки на узел снимает его ссылку
+    // на следующий узел: цепочка освобождается циклом, а не рекурсией, поэтому длинный список
+    // не переполняет стек
+    void Release(Node* node) noexcept {
+        while (node && node->ref_count.fetch_sub(1u, std::memory_order_acq_rel) == 1u) {
+            Node* next = node->next_node;
+            NodeAllocTraits::destroy(node_alloc_, node);
+            NodeAllocTraits::deallocate(node_alloc_, node, 1u);
+            node = next;
+        }
+    }
+};
+
+// Функция обмена формата swap(lhs, rhs)
+template <typename Type, typename Allocator>
+void swap(PersistentSingleLinkedList<Type, Allocator>& lhs, PersistentSingleLinkedList<Type, Allocator>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+// Оператор сравнения списков "==". Списки с общими узлами равны без прохода по элементам
+template <typename Type, typename Allocator>
+bool operator == (const PersistentSingleLinkedList<Type, Allocator>& lhs, const PersistentSingleLinkedList<Type, Allocator>& rhs) {
+    if (lhs.GetSize() != rhs.GetSize()) {
+        return false;
+    }
+    return lhs.SharesNodesWith(rhs) || std::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin());
+}
+
+// Оператор сравнения списков "<"
+template <typename Type, typename Allocator>
+bool operator < (const PersistentSingleLinkedList<Type, Allocator>& lhs, const PersistentSingleLinkedList<Type, Allocator>& rhs) {
+    return std::lexicographical_compare(lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend());
+}
+
+// Производные от "==" и "<" операторы сравнения списков
+template <typename Type, typename Allocator>
+bool operator != (const PersistentSingleLinkedList<Type, Allocator>& lhs, const PersistentSingleLinkedList<Type, Allocator>& rhs) { return !(lhs == rhs); }
+
+template <typename Type, typename Allocator>
+bool operator >  (const PersistentSingleLinkedList<Type, Allocator>& lhs, const PersistentSingleLinkedList<Type, Allocator>& rhs) { return rhs < lhs; }
+
+template <typename Type, typename Allocator>
+bool operator <= (const PersistentSingleLinkedList<Type, Allocator>& lhs, const PersistentSingleLinkedList<Type, Allocator>& rhs) { return !(rhs < lhs); }
+
+template <typename Type, typename Allocator>
+bool operator >= (const PersistentSingleLinkedList<Type, Allocator>& lhs, const PersistentSingleLinkedList<Type, Allocator>& rhs) { return !(lhs < rhs); }
+
+// Оператор "<<" для вывода содержимого списка в поток
+template <typename Type, typename Allocator>
+std::ostream& operator << (std::ostream& os, const PersistentSingleLinkedList<Type, Allocator>& persistent_list) {
+    using namespace std::literals;
+    os << "{"s;
+    bool first = true;
+    for (const Type& element : persistent_list) {
+        if (!first) os << ", "s;
+        else        first = false;
+        os << element;
+    }
+    os << "}"s;
+    return os;
+}
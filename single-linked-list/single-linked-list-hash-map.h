@@ -0,0 +1,491 @@
+#pragma once
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "single-linked-list.h"
+#include "node-pool-allocator.h"
+
+// Хеш-таблица с цепочками (аналог std::unordered_map) на одном общем SingleLinkedList.
+// Все элементы лежат в одном списке, элементы одной корзины - подряд. Корзина хранит итератор на узел
+// перед своим первым элементом (для корзины первого элемента списка - фиктивный узел списка), поэтому
+// вставка в корзину и удаление из неё - это InsertAfter/EraseAfter списка, а полный обход таблицы - обход
+// списка без просмотра пустых корзин. В узле вместе с элементом хранится его хеш: корзина соседнего
+// элемента находится без вызова хеш-функции.
+// По умолчанию узлы выделяются из общего пула NodePoolAllocator.
+// Когда среднее число элементов в корзине превышает kMaxLoadFactor, число корзин удваивается постепенно:
+// новый массив корзин выделяется сразу, а элементы старых корзин переносятся по kRehashStep корзин за
+// каждую вставку или удаление. При удвоении старая корзина b делится на новые корзины b и b + n,
+// и её элементы переставляются в две подряд идущие части. Пока перенос не закончен, поиск смотрит
+// в новую корзину для уже перенесённых старых корзин и в старую - для остальных.
+// Вставка не делает недействительными итераторы и ссылки на элементы; перенос корзин тоже
+template <typename Key, typename Value, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>,
+          typename Allocator = NodePoolAllocator<std::pair<const Key, Value>>>
+class HashMap {
+public:
+    using value_type = std::pair<const Key, Value>;
+    using key_type = Key;
+    using mapped_type = Value;
+
+private:
+    // Элемент общего списка: хеш ключа и пара ключ-значение
+    struct Entry {
+        template <typename... Args>
+        explicit Entry(size_t entry_hash, Args&&... args) : hash(entry_hash), kv(std::forward<Args>(args)...) { }
+
+        size_t hash;
+        value_type kv;
+    };
+
+    using EntryAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Entry>;
+    using Chain = SingleLinkedList<Entry, EntryAllocator>;
+    using ChainIterator = typename Chain::Iterator;
+    using ChainConstIterator = typename Chain::ConstIterator;
+
+    // Количество корзин в новой таблице, наибольшая средняя длина цепочки и количество старых корзин,
+    // переносимых за одну вставку или удаление
+    static constexpr size_t kMinBucketCount = 8u;
+    static constexpr double kMaxLoadFactor = 1.0;
+    static constexpr size_t kRehashStep = 2u;
+
+    // Класс итератора/константного итератора (ValueType=value_type/const value_type) таблицы
+    template <typename ValueType, typename ListIterator>
+    class BasicIterator {
+        // Предоставим классу таблицы и другим итераторам доступ к приватным полям и методам
+        friend class HashMap;
+        template <typename, typename> friend class BasicIterator;
+
+    public:
+        // Описание типа итератора
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = HashMap::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = ValueType*;
+        using reference = ValueType&;
+
+        // Конструктор по умолчанию
+        BasicIterator() = default;
+
+        // Конструктор копирования
+        BasicIterator(const BasicIterator<HashMap::value_type, ChainIterator>& other) noexcept : it_(other.it_) { }
+
+        // Оператор присваивания
+        BasicIterator& operator = (const BasicIterator& rhs) = default;
+
+        // Операторы сравнения
+        template <typename OtherValueType, typename OtherListIterator>
+        [[nodiscard]] bool operator == (const BasicIterator<OtherValueType, OtherListIterator>& rhs) const noexcept { return it_ == rhs.it_; }
+        template <typename OtherValueType, typename OtherListIterator>
+        [[nodiscard]] bool operator != (const BasicIterator<OtherValueType, OtherListIterator>& rhs) const noexcept { return !(*this == rhs); }
+
+        // Преинкремент
+        BasicIterator& operator ++ () noexcept {
+            ++it_;
+            return *this;
+        }
+
+        // Постинкремент
+        BasicIterator operator ++ (int) noexcept {
+            BasicIterator tmp(*this);
+            ++(*this);
+            return tmp;
+        }
+
+        // Оператор разыменовывания
+        [[nodiscard]] reference operator * () const noexcept { return it_->kv; }
+
+        // Оператор доступа к членам
+        [[nodiscard]] pointer operator -> () const noexcept { return &it_->kv; }
+
+    private:
+        // Итератор общего списка
+        ListIterator it_;
+
+        // Конструктор, создающий итератор из итератора общего списка (используется в классе таблицы)
+        explicit BasicIterator(ListIterator it) noexcept : it_(it) { }
+    };
+
+public:
+    using Iterator      = BasicIterator<value_type, ChainIterator>;
+    using ConstIterator = BasicIterator<const value_type, ChainConstIterator>;
+
+    // Конструктор, создающий пустую таблицу с не менее чем bucket_count корзинами
+    explicit HashMap(size_t bucket_count = kMinBucketCount, const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual(),
+                     const Allocator& alloc = Allocator())
+        : chain_(EntryAllocator(alloc)), hash_(hash), equal_(equal) {
+        size_t count = kMinBucketCount;
+        while (count < bucket_count) count *= 2u;
+        buckets_.assign(count, ChainConstIterator());
+    }
+
+    // Конструктор, создающий таблицу из элементов std::initializer_list
+    HashMap(std::initializer_list<value_type> values) : HashMap(values.size()) {
+        for (const value_type& value : values) {
+            Insert(value);
+        }
+    }
+
+    // Конструктор копирования: копия получает корзины по размеру оригинала, без переносов корзин
+    HashMap(const HashMap& other)
+        : chain_(std::allocator_traits<EntryAllocator>::select_on_container_copy_construction(other.chain_.get_allocator())),
+          hash_(other.hash_), equal_(other.equal_) {
+        buckets_.assign(other.GetBucketCount(), ChainConstIterator());
+        for (const Entry& entry : other.chain_) {
+            InsertUnique(entry.hash, entry.kv);
+        }
+    }
+
+    // Конструктор перемещения: узлы переходят к новой таблице без копирования (other получает новые пустые корзины)
+    HashMap(HashMap&& other) : chain_(std::move(other.chain_)), buckets_(std::move(other.buckets_)),
+        old_buckets_(std::move(other.old_buckets_)), migrated_(other.migrated_), hash_(other.hash_), equal_(other.equal_) {
+        FixFrontBucket();
+        other.buckets_.assign(kMinBucketCount, ChainConstIterator());
+        other.old_buckets_.clear();
+        other.migrated_ = 0u;
+    }
+
+    // Оператор присваивания
+    HashMap& operator = (const HashMap& rhs) {
+        if (this != &rhs) {
+            HashMap rhs_copy(rhs);
+            swap(rhs_copy);
+        }
+        return *this;
+    }
+
+    // Оператор перемещающего присваивания
+    HashMap& operator = (HashMap&& rhs) {
+        if (this != &rhs) {
+            HashMap rhs_moved(std::move(rhs));
+            swap(rhs_moved);
+        }
+        return *this;
+    }
+
+    // Итераторы, указывающие на начало и конец таблицы (порядок элементов не определён)
+    [[nodiscard]] Iterator      begin()        noexcept { return Iterator(chain_.begin()); }
+    [[nodiscard]] Iterator      end()          noexcept { return Iterator(chain_.end()); }
+    [[nodiscard]] ConstIterator begin()  const noexcept { return cbegin(); }
+    [[nodiscard]] ConstIterator end()    const noexcept { return cend(); }
+    [[nodiscard]] ConstIterator cbegin() const noexcept { return ConstIterator(chain_.cbegin()); }
+    [[nodiscard]] ConstIterator cend()   const noexcept { return ConstIterator(chain_.cend()); }
+
+    // Функция обмена с другой таблицей
+    void swap(HashMap& other) noexcept {
+        using std::swap;
+        chain_.swap(other.chain_);
+        swap(buckets_, other.buckets_);
+        swap(old_buckets_, other.old_buckets_);
+        swap(migrated_, other.migrated_);
+        swap(hash_, other.hash_);
+        swap(equal_, other.equal_);
+        FixFrontBucket();
+        other.FixFrontBucket();
+    }
+
+    // Функция получения копии аллокатора
+    [[nodiscard]] Allocator get_allocator() const noexcept { return Allocator(chain_.get_allocator()); }
+
+    // Функция получения количества элементов
+    [[nodiscard]] size_t GetSize() const noexcept { return chain_.GetSize(); }
+
+    // Функция проверки на пустоту
+    [[nodiscard]] bool IsEmpty() const noexcept { return chain_.IsEmpty(); }
+
+    // Функция получения количества корзин (во время переноса - количества новых корзин)
+    [[nodiscard]] size_t GetBucketCount() const noexcept { return buckets_.size(); }
+
+    // Функция получения средней длины цепочки
+    [[nodiscard]] double GetLoadFactor() const noexcept {
+        return static_cast<double>(GetSize()) / static_cast<double>(GetBucketCount());
+    }
+
+    // Функция проверки того, что перенос старых корзин ещё не закончен
+    [[nodiscard]] bool IsRehashing() const noexcept { return !old_buckets_.empty(); }
+
+    // Функции поиска элемента по ключу. Возвращают end(), если ключа нет
+    [[nodiscard]] Iterator Find(const Key& key) {
+        const ChainConstIterator before = FindBefore(key, hash_(key));
+        return before == ChainConstIterator() ? end() : Iterator(NextMutable(before));
+    }
+
+    [[nodiscard]] ConstIterator Find(const Key& key) const {
+        const ChainConstIterator before = FindBefore(key, hash_(key));
+        return before == ChainConstIterator() ? cend() : ConstIterator(std::next(before));
+    }
+
+    // Функция проверки наличия ключа
+    [[nodiscard]] bool Contains(const Key& key) const { return FindBefore(key, hash_(key)) != ChainConstIterator(); }
+
+    // Функции доступа к значению по ключу. Выбрасывают std::out_of_range, если ключа нет
+    [[nodiscard]] Value& At(const Key& key) {
+        const Iterator it = Find(key);
+        if (it == end()) {
+            throw std::out_of_range("HashMap::At: key not found");
+        }
+        return it->second;
+    }
+
+    [[nodiscard]] const Value& At(const Key& key) const {
+        const ConstIterator it = Find(key);
+        if (it == cend()) {
+            throw std::out_of_range("HashMap::At: key not found");
+        }
+        return it->second;
+    }
+
+    // Функция доступа к значению по ключу: если ключа нет, добавляет элемент со значением по умолчанию
+    Value& operator [] (const Key& key) { return TryEmplace(key).first->second; }
+
+    // Функция добавления элемента. Если ключ уже есть, таблица не меняется.
+    // Возвращает итератор на элемент с ключом и признак того, что элемент добавлен
+    std::pair<Iterator, bool> Insert(const value_type& value) { return TryEmplace(value.first, value.second); }
+    std::pair<Iterator, bool> Insert(value_type&& value) { return TryEmplace(value.first, std::move(value.second)); }
+
+    // Функция создания элемента с ключом key и значением из аргументов конструктора Value, если ключа ещё нет
+    template <typename... Args>
+    std::pair<Iterator, bool> TryEmplace(const Key& key, Args&&... args) {
+        const size_t hash = hash_(key);
+        const ChainConstIterator before = FindBefore(key, hash);
+        if (before != ChainConstIterator()) {
+            return { Iterator(NextMutable(before)), false };
+        }
+
+        if (IsRehashing()) {
+            MigrateBuckets(kRehashStep);
+        } else if (static_cast<double>(GetSize() + 1u) > kMaxLoadFactor * static_cast<double>(GetBucketCount())) {
+            StartRehash();
+            MigrateBuckets(kRehashStep);
+        }
+        return { Iterator(InsertUnique(hash, std::piecewise_construct, std::forward_as_tuple(key),
+                                       std::forward_as_tuple(std::forward<Args>(args)...))), true };
+    }
+
+    // Функция удаления элемента по ключу. Возвращает количество удалённых элементов (0 или 1)
+    size_t Erase(const Key& key) {
+        const ChainConstIterator before = FindBefore(key, hash_(key));
+        if (before == ChainConstIterator()) {
+            return 0u;
+        }
+        EraseNodeAfter(before);
+        MigrateBuckets(kRehashStep);
+        return 1u;
+    }
+
+    // Функция удаления элемента, на который указывает итератор. Возвращает итератор на следующий элемент
+    Iterator Erase(ConstIterator pos) {
+        assert(pos.it_ != chain_.cend());
+
+        ChainConstIterator before = BucketRef(pos.it_->hash);
+        while (std::next(before) != pos.it_) {
+            ++before;
+        }
+        const ChainIterator next = EraseNodeAfter(before);
+        MigrateBuckets(kRehashStep);
+        return Iterator(next);
+    }
+
+    // Функция подготовки таблицы к count элементам без удвоений числа корзин при их вставке
+    void Reserve(size_t count) {
+        MigrateBuckets(old_buckets_.size());
+        while (static_cast<double>(count) > kMaxLoadFactor * static_cast<double>(GetBucketCount())) {
+            StartRehash();
+            MigrateBuckets(old_buckets_.size());
+        }
+    }
+
+    // Очистка таблицы (число корзин не меняется)
+    void Clear() noexcept {
+        old_buckets_.clear();
+        migrated_ = 0u;
+        chain_.Clear();
+        std::fill(buckets_.begin(), buckets_.end(), ChainConstIterator());
+    }
+
+private:
+    Chain chain_;                                  // Общий список всех элементов
+    std::vector<ChainConstIterator> buckets_;      // Корзины: узел перед первым элементом корзины (или пустой итератор)
+    std::vector<ChainConstIterator> old_buckets_;  // Старые корзины во время переноса
+    size_t migrated_ = 0u;                         // Количество уже перенесённых старых корзин
+    Hash hash_;
+    KeyEqual equal_;
+
+    // Функция получения корзины элемента с хешем hash: старой, если она ещё не перенесена, иначе новой
+    ChainConstIterator& BucketRef(size_t hash) noexcept {
+        if (IsRehashing()) {
+            const size_t old_index = hash & (old_buckets_.size() - 1u);
+            if (old_index >= migrated_) {
+                return old_buckets_[old_index];
+            }
+        }
+        return buckets_[hash & (buckets_.size() - 1u)];
+    }
+
+    const ChainConstIterator& BucketRef(size_t hash) const noexcept {
+        return const_cast<HashMap*>(this)->BucketRef(hash);
+    }
+
+    // Функция получения неконстантного итератора на элемент после before
+    ChainIterator NextMutable(ChainConstIterator before) noexcept {
+        return chain_.MakeMutable(std::next(before));
+    }
+
+    // Функция поиска узла перед элементом с ключом key. Возвращает пустой итератор, если ключа нет
+    ChainConstIterator FindBefore(const Key& key, size_t hash) const {
+        const ChainConstIterator& bucket = BucketRef(hash);
+        if (bucket == ChainConstIterator()) {
+            return ChainConstIterator();
+        }
+
+        ChainConstIterator before = bucket;
+        for (ChainConstIterator it = std::next(before); it != chain_.cend(); before = it++) {
+            if (&BucketRef(it->hash) != &bucket) {
+                break;
+            }
+            if (it->hash == hash && equal_(it->kv.first, key)) {
+                return before;
+            }
+        }
+        return ChainConstIterator();
+    }
+
+    // Функция добавления элемента с ключом, которого ещё нет в таблице: первым в свою корзину или,
+    // если корзина пуста, в начало списка (тогда корзина прежнего первого элемента начинается после нового)
+    template <typename... Args>
+    ChainIterator InsertUnique(size_t hash, Args&&... args) {
+        ChainConstIterator& bucket = BucketRef(hash);
+        if (bucket != ChainConstIterator()) {
+            return chain_.EmplaceAfter(bucket, hash, std::forward<Args>(args)...);
+        }
+
+        const ChainIterator node = chain_.EmplaceAfter(chain_.cbefore_begin(), hash, std::forward<Args>(args)...);
+        const ChainConstIterator next = std::next(ChainConstIterator(node));
+        if (next != chain_.cend()) {
+            BucketRef(next->hash) = node;
+        }
+        bucket = chain_.cbefore_begin();
+        return node;
+    }
+
+    // Функция удаления элемента после узла before с обновлением корзин: корзина, ставшая пустой,
+    // очищается, а корзина следующего элемента получает новый узел перед собой
+    ChainIterator EraseNodeAfter(ChainConstIterator before) noexcept {
+        const ChainConstIterator node = std::next(before);
+        ChainConstIterator& bucket = BucketRef(node->hash);
+        const ChainConstIterator next = std::next(node);
+        ChainConstIterator* next_bucket = next != chain_.cend() ? &BucketRef(next->hash) : nullptr;
+
+        if (before == bucket) {
+            if (next_bucket != &bucket) {
+                if (next_bucket) *next_bucket = bucket;
+                bucket = ChainConstIterator();
+            }
+        } else if (next_bucket && next_bucket != &bucket) {
+            *next_bucket = before;
+        }
+        return chain_.EraseAfter(before);
+    }
+
+    // Функция начала удвоения числа корзин: текущие корзины становятся старыми
+    void StartRehash() {
+        std::vector<ChainConstIterator> new_buckets(buckets_.size() * 2u, ChainConstIterator());
+        old_buckets_ = std::exchange(buckets_, std::move(new_buckets));
+        migrated_ = 0u;
+    }
+
+    // Функция переноса не более count старых корзин
+    void MigrateBuckets(size_t count) noexcept {
+        for (; count > 0u && IsRehashing(); --count) {
+            MigrateBucket();
+        }
+    }
+
+    // Функция переноса очередной старой корзины b: её элементы переставляются так, что сначала идут
+    // элементы новой корзины b, затем элементы новой корзины b + n (n - количество старых корзин)
+    void MigrateBucket() noexcept {
+        const size_t old_count = old_buckets_.size();
+        const size_t index = migrated_;
+        const ChainConstIterator before = old_buckets_[index];
+        ++migrated_;
+
+        if (before != ChainConstIterator()) {
+            // Элементы новой корзины b + n по порядку переходят во временный список, затем подцепляются
+            // после последнего оставшегося элемента. Узлы перецепляются, итераторы остаются действительными
+            Chain high(chain_.get_allocator());
+            ChainConstIterator high_back = high.cbefore_begin();
+            ChainConstIterator low_back = before;
+            for (ChainConstIterator it = std::next(low_back);
+                 it != chain_.cend() && (it->hash & (old_count - 1u)) == index; it = std::next(low_back)) {
+                if (it->hash & old_count) {
+                    high.SpliceAfter(high_back, chain_, low_back);
+                    high_back = it;
+                } else {
+                    low_back = it;
+                }
+            }
+
+            const bool has_low = low_back != before;
+            const bool has_high = !high.IsEmpty();
+            const ChainConstIterator run_back = has_high ? high_back : low_back;
+            if (has_high) {
+                chain_.SpliceAfter(low_back, high);
+            }
+            buckets_[index] = has_low ? before : ChainConstIterator();
+            buckets_[index + old_count] = has_high ? low_back : ChainConstIterator();
+
+            // Узел перед следующей корзиной мог смениться
+            const ChainConstIterator next = std::next(run_back);
+            if (next != chain_.cend()) {
+                BucketRef(next->hash) = run_back;
+            }
+        }
+
+        if (migrated_ == old_count) {
+            old_buckets_.clear();
+            old_buckets_.shrink_to_fit();
+            migrated_ = 0u;
+        }
+    }
+
+    // Функция восстановления корзины первого элемента после обмена или перемещения списка:
+    // она ссылается на фиктивный узел, который у каждого списка свой
+    void FixFrontBucket() noexcept {
+        if (!chain_.IsEmpty()) {
+            BucketRef(chain_.front().hash) = chain_.cbefore_begin();
+        }
+    }
+};
+
+// Функция обмена формата swap(lhs, rhs)
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename Allocator>
+void swap(HashMap<Key, Value, Hash, KeyEqual, Allocator>& lhs, HashMap<Key, Value, Hash, KeyEqual, Allocator>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+// Оператор сравнения таблиц "==": одинаковые наборы ключей с равными значениями
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename Allocator>
+bool operator == (const HashMap<Key, Value, Hash, KeyEqual, Allocator>& lhs, const HashMap<Key, Value, Hash, KeyEqual, Allocator>& rhs) {
+    if (lhs.GetSize() != rhs.GetSize()) {
+        return false;
+    }
+    for (const auto& [key, value] : lhs) {
+        const auto it = rhs.Find(key);
+        if (it == rhs.cend() || !(it->second == value)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual, typename Allocator>
+bool operator != (const HashMap<Key, Value, Hash, KeyEqual, Allocator>& lhs, const HashMap<Key, Value, Hash, KeyEqual, Allocator>& rhs) {
+    return !(lhs == rhs);
+}
@@ -0,0 +1,294 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Пул потоков для параллельных алгоритмов над списками. Выполняет по одной задаче ParallelFor за раз;
+// вызывающий поток участвует в выполнении задачи наравне с потоками пула
+class ThreadPool {
+public:
+    // Конструктор: threads - общее количество потоков, выполняющих задачу (вместе с вызывающим)
+    explicit ThreadPool(size_t threads = std::thread::hardware_concurrency()) {
+        const size_t workers = threads > 1u ? threads - 1u : 0u;
+        workers_.reserve(workers);
+        try {
+            for (size_t i = 0u; i < workers; ++i) {
+                workers_.emplace_back([this] { WorkerLoop(); });
+            }
+        } catch (...) {
+            Stop();
+            throw;
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator = (const ThreadPool&) = delete;
+
+    // Деструктор дожидается завершения всех потоков пула
+    ~ThreadPool() noexcept { Stop(); }
+
+    // Количество потоков, выполняющих задачу (вместе с вызывающим)
+    [[nodiscard]] size_t GetThreadCount() const noexcept { return workers_.size() + 1u; }
+
+    // Выполнение function(index) для всех index из [0; count). Возвращает управление, когда все вызовы
+    // завершены. Если вызов выбросил исключение, оставшиеся индексы пропускаются, а исключение
+    // пробрасывается вызывающему
+    template <typename Function>
+    void ParallelFor(size_t count, Function function) {
+        if (count == 0u) {
+            return;
+        }
+
+        std::lock_guard submit_lock(submit_mutex_);
+        Job job;
+        job.count = count;
+        job.context = &function;
+        job.run = [](void* context, size_t index) { (*static_cast<Function*>(context))(index); };
+        {
+            std::lock_guard lock(mutex_);
+            job_ = &job;
+            ++generation_;
+        }
+        work_cv_.notify_all();
+
+        RunJob(job);
+
+        std::unique_lock lock(mutex_);
+        job_ = nullptr;
+        done_cv_.wait(lock, [&job] { return job.active == 0u; });
+        if (job.exception) {
+            std::rethrow_exception(job.exception);
+        }
+    }
+
+private:
+    // Задача: вызовы run(context, index) для index из [0; count)
+    struct Job {
+        size_t count = 0u;
+        void* context = nullptr;
+        void (*run)(void*, size_t) = nullptr;
+        std::atomic<size_t> next{ 0u };  // Следующий невыданный индекс
+        size_t active = 0u;              // Потоки пула, выполняющие задачу (под mutex_)
+        std::mutex exception_mutex;
+        std::exception_ptr exception;    // Первое выброшенное исключение
+    };
+
+    std::vector<std::thread> workers_;
+    std::mutex submit_mutex_;            // Очередь на выполнение задач
+    std::mutex mutex_;
+    std::condition_variable work_cv_;    // Появилась задача или пул останавливается
+    std::condition_variable done_cv_;    // Поток пула закончил задачу
+    Job* job_ = nullptr;                 // Текущая задача
+    uint64_t generation_ = 0u;           // Номер текущей задачи
+    bool stop_ = false;
+
+    // Выполнение вызовов задачи, пока есть невыданные индексы
+    static void RunJob(Job& job) noexcept {
+        for (size_t index = job.next.fetch_add(1u); index < job.count; index = job.next.fetch_add(1u)) {
+            try {
+                job.run(job.context, index);
+            } catch (...) {
+                std::lock_guard lock(job.exception_mutex);
+                if (!job.exception) {
+                    job.exception = std::current_exception();
+                }
+                job.next.store(job.count);
+            }
+        }
+    }
+
+    // Цикл потока пула: ожидание новой задачи и участие в её выполнении
+    void WorkerLoop() noexcept {
+        uint64_t seen_generation = 0u;
+        std::unique_lock lock(mutex_);
+        while (true) {
+            work_cv_.wait(lock, [this, seen_generation] { return stop_ || generation_ != seen_generation; });
+            if (stop_) {
+                return;
+            }
+            seen_generation = generation_;
+            Job* job = job_;
+            if (!job) {
+                continue;
+            }
+
+            ++job->active;
+            lock.unlock();
+            RunJob(*job);
+            lock.lock();
+            if (--job->active == 0u) {
+                done_cv_.notify_all();
+            }
+        }
+    }
+
+    // Остановка и ожидание потоков пула
+    void Stop() noexcept {
+        {
+            std::lock_guard lock(mutex_);
+            stop_ = true;
+        }
+        work_cv_.notify_all();
+        for (std::thread& worker : workers_) {
+            worker.join();
+        }
+        workers_.clear();
+    }
+};
+
+// Разбиение списка на отрезки примерно равной длины за один проход. Количество отрезков зависит только
+// от размера списка (не от количества потоков), поэтому результаты параллельных алгоритмов детерминированы.
+// Разбиение действительно, пока список не меняет состав; его можно переиспользовать в нескольких
+// алгоритмах, чтобы не платить за последовательный проход разбиения при каждом вызове
+template <typename List>
+class ListSegments {
+public:
+    using Iterator = decltype(std::declval<List&>().begin());
+
+    // Минимальная длина отрезка и максимальное количество отрезков
+    static constexpr size_t kMinSegmentLength = 4096u;
+    static constexpr size_t kMaxSegments = 256u;
+
+    // Конструктор: проходит по списку и запоминает начала отрезков
+    explicit ListSegments(List& list)
+        : size_(list.GetSize()), count_(size_ == 0u ? 0u : std::clamp<size_t>(size_ / kMinSegmentLength, 1u, kMaxSegments)) {
+        begins_.reserve(count_);
+        Iterator it = list.begin();
+        for (size_t i = 0u; i < count_; ++i) {
+            begins_.push_back(it);
+            if (i + 1u < count_) {
+                std::advance(it, GetLength(i));
+            }
+        }
+    }
+
+    // Количество отрезков
+    [[nodiscard]] size_t GetCount() const noexcept { return count_; }
+
+    // Размер разбитого списка
+    [[nodiscard]] size_t GetSize() const noexcept { return size_; }
+
+    // Начало и длина отрезка с номером index
+    [[nodiscard]] Iterator GetBegin(size_t index) const noexcept {
+        assert(index < count_);
+        return begins_[index];
+    }
+
+    [[nodiscard]] size_t GetLength(size_t index) const noexcept {
+        assert(index < count_);
+        return size_ / count_ + (index < size_ % count_ ? 1u : 0u);
+    }
+
+private:
+    size_t size_;
+    size_t count_;
+    std::vector<Iterator> begins_;
+};
+
+// Проверка того, что тип - разбиение списка (чтобы перегрузки для списков не перехватывали разбиения)
+template <typename T>
+struct IsListSegments : std::false_type { };
+
+template <typename List>
+struct IsListSegments<ListSegments<List>> : std::true_type { };
+
+// Параллельный вызов function для каждого элемента. Элементы разных отрезков обрабатываются
+// разными потоками, поэтому function не должна менять общие данные без синхронизации
+template <typename List, typename Function>
+void ParallelForEach(ThreadPool& pool, const ListSegments<List>& segments, Function function) {
+    pool.ParallelFor(segments.GetCount(), [&segments, &function](size_t index) {
+        auto it = segments.GetBegin(index);
+        for (size_t n = segments.GetLength(index); n > 0u; --n, ++it) {
+            function(*it);
+        }
+    });
+}
+
+template <typename List, typename Function, typename = std::enable_if_t<!IsListSegments<std::remove_const_t<List>>::value>>
+void ParallelForEach(ThreadPool& pool, List& list, Function function) {
+    ParallelForEach(pool, ListSegments<List>(list), std::move(function));
+}
+
+// Параллельная запись op(x) для каждого элемента x списка input в соответствующий элемент списка output
+// такого же размера (output может совпадать с input)
+template <typename InputList, typename OutputList, typename UnaryOperation>
+void ParallelTransform(ThreadPool& pool, const InputList& input, OutputList& output, UnaryOperation op) {
+    assert(input.GetSize() == output.GetSize());
+
+    const ListSegments<const InputList> input_segments(input);
+    const ListSegments<OutputList> output_segments(output);
+    pool.ParallelFor(input_segments.GetCount(), [&input_segments, &output_segments, &op](size_t index) {
+        auto src = input_segments.GetBegin(index);
+        auto dst = output_segments.GetBegin(index);
+        for (size_t n = input_segments.GetLength(index); n > 0u; --n, ++src, ++dst) {
+            *dst = op(*src);
+        }
+    });
+}
+
+// Параллельная свёртка элементов операцией op (ассоциативной, но не обязательно коммутативной).
+// Каждый отрезок сворачивается отдельно, затем частичные результаты сворачиваются по порядку отрезков,
+// начиная с init. При одном и том же размере списка порядок применения op не зависит от числа потоков
+template <typename List, typename T, typename BinaryOperation = std::plus<>>
+T ParallelReduce(ThreadPool& pool, const ListSegments<List>& segments, T init, BinaryOperation op = BinaryOperation()) {
+    std::vector<std::optional<T>> partials(segments.GetCount());
+    pool.ParallelFor(segments.GetCount(), [&segments, &op, &partials](size_t index) {
+        auto it = segments.GetBegin(index);
+        T partial = *it;
+        for (size_t n = segments.GetLength(index) - 1u; n > 0u; --n) {
+            partial = op(std::move(partial), *++it);
+        }
+        partials[index] = std::move(partial);
+    });
+
+    for (std::optional<T>& partial : partials) {
+        init = op(std::move(init), std::move(*partial));
+    }
+    return init;
+}
+
+template <typename List, typename T, typename BinaryOperation = std::plus<>>
+T ParallelReduce(ThreadPool& pool, const List& list, T init, BinaryOperation op = BinaryOperation()) {
+    return ParallelReduce(pool, ListSegments<const List>(list), std::move(init), std::move(op));
+}
+
+// Параллельный подсчёт элементов, удовлетворяющих предикату
+template <typename List, typename UnaryPredicate>
+size_t ParallelCountIf(ThreadPool& pool, const ListSegments<List>& segments, UnaryPredicate pred) {
+    // Счётчики отрезков разнесены по строкам кэша, чтобы потоки не мешали друг другу
+    struct alignas(64) Counter {
+        size_t value = 0u;
+    };
+    std::vector<Counter> counters(segments.GetCount());
+    pool.ParallelFor(segments.GetCount(), [&segments, &pred, &counters](size_t index) {
+        auto it = segments.GetBegin(index);
+        size_t count = 0u;
+        for (size_t n = segments.GetLength(index); n > 0u; --n, ++it) {
+            if (pred(*it)) ++count;
+        }
+        counters[index].value = count;
+    });
+
+    size_t count = 0u;
+    for (const Counter& counter : counters) {
+        count += counter.value;
+    }
+    return count;
+}
+
+template <typename List, typename UnaryPredicate>
+size_t ParallelCountIf(ThreadPool& pool, const List& list, UnaryPredicate pred) {
+    return ParallelCountIf(pool, ListSegments<const List>(list), std::move(pred));
+}
@@ -0,0 +1,414 @@
+#pragma once
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "single-linked-list.h"
+
+// Двоичный формат списка: заголовок (сигнатура и размер элемента), затем последовательность блоков
+// [количество элементов: uint32][размер данных в байтах: uint32][данные] и завершающий блок с нулём
+// элементов. Числа записываются в порядке байтов платформы. Блоки позволяют писать и читать список
+// потоково, не зная заранее его размер и не держа его целиком в памяти
+
+// Кодирование элемента типа Type в байты. Для тривиально копируемых типов байты объекта копируются
+// через memcpy; для других типов нужно объявить специализацию с функциями Encode/Decode
+template <typename Type, typename = void>
+struct BinaryCodec;
+
+template <typename Type>
+struct BinaryCodec<Type, std::enable_if_t<std::is_trivially_copyable_v<Type>>> {
+    // Размер закодированного элемента (0 - размер переменный)
+    static constexpr uint32_t kElementSize = sizeof(Type);
+
+    static void Encode(std::vector<char>& out, const Type& value) {
+        const size_t offset = out.size();
+        out.resize(offset + sizeof(Type));
+        std::memcpy(out.data() + offset, &value, sizeof(Type));
+    }
+
+    static Type Decode(const char*& pos, const char* end) {
+        if (static_cast<size_t>(end - pos) < sizeof(Type)) {
+            throw std::runtime_error("truncated list element");
+        }
+        Type value;
+        std::memcpy(&value, pos, sizeof(Type));
+        pos += sizeof(Type);
+        return value;
+    }
+};
+
+// Строки кодируются длиной (uint64) и символами
+template <typename Char, typename Traits, typename Allocator>
+struct BinaryCodec<std::basic_string<Char, Traits, Allocator>> {
+    using String = std::basic_string<Char, Traits, Allocator>;
+    static_assert(std::is_trivially_copyable_v<Char>);
+
+    static constexpr uint32_t kElementSize = 0u;
+
+    static void Encode(std::vector<char>& out, const String& value) {
+        const uint64_t length = value.size();
+        const size_t offset = out.size();
+        out.resize(offset + sizeof(length) + length * sizeof(Char));
+        std::memcpy(out.data() + offset, &length, sizeof(length));
+        std::memcpy(out.data() + offset + sizeof(length), value.data(), length * sizeof(Char));
+    }
+
+    static String Decode(const char*& pos, const char* end) {
+        uint64_t length = 0u;
+        if (static_cast<size_t>(end - pos) < sizeof(length)) {
+            throw std::runtime_error("truncated list element");
+        }
+        std::memcpy(&length, pos, sizeof(length));
+        pos += sizeof(length);
+        if (length > static_cast<size_t>(end - pos) / sizeof(Char)) {
+            throw std::runtime_error("truncated list element");
+        }
+        String value(static_cast<size_t>(length), Char());
+        std::memcpy(value.data(), pos, static_cast<size_t>(length) * sizeof(Char));
+        pos += static_cast<size_t>(length) * sizeof(Char);
+        return value;
+    }
+};
+
+// Константы двоичного формата
+namespace binary_format {
+    inline constexpr uint32_t kSignature = 0x314C4C53u;   // "SLL1"
+    inline constexpr uint32_t kChunkElements = 4096u;     // Максимум элементов в блоке
+    inline constexpr size_t kChunkBytes = 1u << 16;       // Размер данных, после которого блок записывается
+    inline constexpr size_t kMaxChunkBytes = std::numeric_limits<uint32_t>::max(); // Предел размера данных блока
+}
+
+// Потоковая запись элементов в двоичном формате. Элементы копируются в буфер блока, а в поток
+// уходят целыми блоками, поэтому запись не требует держать список в памяти
+template <typename Type>
+class BinaryListWriter {
+public:
+    using Codec = BinaryCodec<Type>;
+
+    // Конструктор записывает заголовок формата
+    explicit BinaryListWriter(std::ostream& os) : os_(os) {
+        const uint32_t header[] = { binary_format::kSignature, Codec::kElementSize };
+        WriteBytes(header, sizeof(header));
+    }
+
+    BinaryListWriter(const BinaryListWriter&) = delete;
+    BinaryListWriter& operator = (const BinaryListWriter&) = delete;
+
+    // Запись одного элемента. Элемент, данные которого не помещаются в блок, - std::length_error
+    void Write(const Type& value) {
+        assert(!finished_);
+        if constexpr (kBulk) {
+            std::memcpy(buffer_.data() + size_t{ buffered_ } * sizeof(Type), &value, sizeof(Type));
+            if (++buffered_ == kBulkChunkElements) {
+                FlushBulkChunk();
+            }
+            return;
+        } else {
+            const size_t chunk_bytes = buffer_.size();
+            Codec::Encode(buffer_, value);
+            if (buffer_.size() > binary_format::kMaxChunkBytes) {
+                if (buffer_.size() - chunk_bytes > binary_format::kMaxChunkBytes) {
+                    buffer_.resize(chunk_bytes);
+                    throw std::length_error("list element is too large to write");
+                }
+                // Размер данных блока записывается 32-битным числом: блок записывается без нового элемента,
+                // и элемент начинает следующий блок
+                FlushChunk(chunk_bytes);
+            }
+            if (++buffered_ == binary_format::kChunkElements || buffer_.size() >= binary_format::kChunkBytes) {
+                FlushChunk();
+            }
+        }
+    }
+
+    // Запись элементов интервала [first; last). Непрерывный интервал тривиально копируемых элементов
+    // копируется в буфер блока кусками одним memcpy на блок
+    template <typename InputIterator>
+    void Write(InputIterator first, InputIterator last) {
+        if constexpr (kBulk && kContiguous<InputIterator>) {
+            assert(!finished_);
+            const Type* data = ToAddress(first);
+            for (size_t count = static_cast<size_t>(last - first); count > 0u;) {
+                const size_t run = std::min<size_t>(count, kBulkChunkElements - buffered_);
+                std::memcpy(buffer_.data() + size_t{ buffered_ } * sizeof(Type), data, run * sizeof(Type));
+                buffered_ += static_cast<uint32_t>(run);
+                data += run;
+                count -= run;
+                if (buffered_ == kBulkChunkElements) {
+                    FlushBulkChunk();
+                }
+            }
+        } else {
+            for (; first != last; ++first) {
+                Write(*first);
+            }
+        }
+    }
+
+    // Завершение записи: оставшиеся элементы и завершающий блок. Без вызова Finish запись неполна
+    void Finish() {
+        assert(!finished_);
+        if constexpr (kBulk) {
+            if (buffered_ > 0u) {
+                FlushBulkChunk();
+            }
+            WriteChunk(0u, nullptr, 0u);
+        } else {
+            if (buffered_ > 0u) {
+                FlushChunk();
+            }
+            FlushChunk();
+        }
+        finished_ = true;
+    }
+
+private:
+    // Тривиально копируемые элементы пишутся в буфер фиксированного размера без Codec::Encode
+    static constexpr bool kBulk = std::is_trivially_copyable_v<Type>;
+    static_assert(!kBulk || sizeof(Type) <= binary_format::kMaxChunkBytes);
+
+    // Количество элементов в блоке при записи через буфер фиксированного размера: тот же предел
+    // kChunkElements/kChunkBytes, что и при поэлементном кодировании
+    static constexpr uint32_t kBulkChunkElements = static_cast<uint32_t>(
+        std::clamp<size_t>(binary_format::kChunkBytes / sizeof(Type), 1u, binary_format::kChunkElements));
+
+    template <typename Iterator>
+    static constexpr bool kContiguous = std::is_same_v<typename std::iterator_traits<Iterator>::value_type, Type>
+#if __cplusplus >= 202002L
+        && std::contiguous_iterator<Iterator>;
+#else
+        && std::is_pointer_v<Iterator>;
+#endif
+
+    template <typename Iterator>
+    static const Type* ToAddress(Iterator it) noexcept {
+#if __cplusplus >= 202002L
+        return std::to_address(it);
+#else
+        return it;
+#endif
+    }
+
+    std::ostream& os_;
+    std::vector<char> buffer_ = std::vector<char>(kBulk ? kBulkChunkElements * sizeof(Type) : 0u);  // Данные текущего блока
+    uint32_t buffered_ = 0u;    // Количество элементов в текущем блоке
+    bool finished_ = false;
+
+    // Запись текущего блока (пустой блок завершает список)
+    void FlushChunk() {
+        FlushChunk(buffer_.size());
+    }
+
+    // Запись блока из buffered_ элементов, занимающих первые chunk_bytes байт буфера.
+    // Остальные байты буфера остаются в нём и начинают следующий блок
+    void FlushChunk(size_t chunk_bytes) {
+        WriteChunk(buffered_, buffer_.data(), chunk_bytes);
+        buffer_.erase(buffer_.begin(), buffer_.begin() + static_cast<std::ptrdiff_t>(chunk_bytes));
+        buffered_ = 0u;
+    }
+
+    // Запись блока из buffered_ тривиально копируемых элементов; буфер остаётся того же размера
+    void FlushBulkChunk() {
+        WriteChunk(buffered_, buffer_.data(), size_t{ buffered_ } * sizeof(Type));
+        buffered_ = 0u;
+    }
+
+    void WriteChunk(uint32_t count, const char* data, size_t bytes) {
+        assert(bytes <= binary_format::kMaxChunkBytes);
+        const uint32_t header[] = { count, static_cast<uint32_t>(bytes) };
+        WriteBytes(header, sizeof(header));
+        WriteBytes(data, bytes);
+    }
+
+    void WriteBytes(const void* data, size_t size) {
+        if (!os_.write(static_cast<const char*>(data), static_cast<std::streamsize>(size))) {
+            throw std::runtime_error("failed to write list");
+        }
+    }
+};
+
+// Потоковое чтение элементов в двоичном формате: блок читается из потока целиком, элементы
+// разбираются из буфера. Итераторы begin()/end() - итераторы ввода, пригодные для конструктора
+// SingleLinkedList(first, last) и InsertAfter(pos, first, last). Ошибки формата - std::runtime_error
+template <typename Type>
+class BinaryListReader {
+public:
+    using Codec = BinaryCodec<Type>;
+
+    // Итератор ввода по элементам потока. Текущий элемент хранится в объекте чтения, поэтому итератор
+    // дёшево копируется, а элемент можно забрать перемещением (std::make_move_iterator)
+    class Iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Type*;
+        using reference = Type&;
+
+        Iterator() = default;
+
+        explicit Iterator(BinaryListReader* reader) : reader_(reader) { ++*this; }
+
+        [[nodiscard]] bool operator == (const Iterator& rhs) const noexcept { return reader_ == rhs.reader_; }
+        [[nodiscard]] bool operator != (const Iterator& rhs) const noexcept { return !(*this == rhs); }
+
+        Iterator& operator ++ () {
+            assert(reader_);
+            reader_->current_ = reader_->Read();
+            if (!reader_->current_) reader_ = nullptr;
+            return *this;
+        }
+
+        void operator ++ (int) { ++*this; }
+
+        [[nodiscard]] reference operator * () const noexcept { return *reader_->current_; }
+        [[nodiscard]] pointer operator -> () const noexcept { return &*reader_->current_; }
+
+    private:
+        BinaryListReader* reader_ = nullptr;
+    };
+
+    // Конструктор проверяет заголовок формата
+    explicit BinaryListReader(std::istream& is) : is_(is) {
+        uint32_t header[2] = {};
+        ReadBytes(header, sizeof(header));
+        if (header[0] != binary_format::kSignature || header[1] != Codec::kElementSize) {
+            throw std::runtime_error("invalid list format");
+        }
+    }
+
+    BinaryListReader(const BinaryListReader&) = delete;
+    BinaryListReader& operator = (const BinaryListReader&) = delete;
+
+    // Чтение следующего элемента (пусто, если элементы закончились)
+    [[nodiscard]] std::optional<Type> Read() {
+        if (remaining_ == 0u && !finished_) {
+            LoadChunk();
+        }
+        if (remaining_ == 0u) {
+            return std::nullopt;
+        }
+
+        if constexpr (kBulk) {
+            // Размер данных блока уже проверен при чтении: bytes == count * sizeof(Type)
+            std::optional<Type> value(std::in_place);
+            std::memcpy(&*value, buffer_.data() + offset_, sizeof(Type));
+            offset_ += sizeof(Type);
+            --remaining_;
+            return value;
+        } else {
+            const char* pos = buffer_.data() + offset_;
+            std::optional<Type> value(std::in_place, Codec::Decode(pos, buffer_.data() + buffer_.size()));
+            offset_ = static_cast<size_t>(pos - buffer_.data());
+            if (--remaining_ == 0u && offset_ != buffer_.size()) {
+                throw std::runtime_error("invalid list chunk");
+            }
+            return value;
+        }
+    }
+
+    // Чтение в out (прежнее содержимое заменяется) неразобранных элементов текущего блока или, если он
+    // разобран, следующего блока. Возвращает количество прочитанных элементов (0 - элементы закончились).
+    // Тривиально копируемые элементы копируются из буфера блока одним memcpy
+    size_t ReadChunk(std::vector<Type>& out) {
+        out.clear();
+        if (remaining_ == 0u && !finished_) {
+            LoadChunk();
+        }
+        if constexpr (kBulk) {
+            out.resize(remaining_);
+            if (remaining_ > 0u) {
+                std::memcpy(out.data(), buffer_.data() + offset_, size_t{ remaining_ } * sizeof(Type));
+                offset_ += size_t{ remaining_ } * sizeof(Type);
+                remaining_ = 0u;
+            }
+        } else {
+            out.reserve(remaining_);
+            while (remaining_ > 0u) {
+                out.push_back(std::move(*Read()));
+            }
+        }
+        return out.size();
+    }
+
+    [[nodiscard]] Iterator begin() { return Iterator(this); }
+    [[nodiscard]] Iterator end() noexcept { return Iterator(); }
+
+private:
+    std::istream& is_;
+    std::vector<char> buffer_;  // Данные текущего блока
+    size_t offset_ = 0u;        // Начало следующего элемента в буфере
+    uint32_t remaining_ = 0u;   // Количество неразобранных элементов блока
+    bool finished_ = false;     // Прочитан завершающий блок
+    std::optional<Type> current_; // Элемент, на который указывает итератор
+
+    static constexpr bool kBulk = std::is_trivially_copyable_v<Type>;
+
+    // Чтение следующего блока
+    void LoadChunk() {
+        uint32_t header[2] = {};
+        ReadBytes(header, sizeof(header));
+        const uint32_t count = header[0];
+        const uint32_t bytes = header[1];
+        if (count > binary_format::kChunkElements || (count == 0u) != (bytes == 0u)
+            || (Codec::kElementSize != 0u && bytes != uint64_t{ count } * Codec::kElementSize)) {
+            throw std::runtime_error("invalid list chunk");
+        }
+
+        // Данные читаются частями не больше kChunkBytes: размер блока из повреждённого или обрезанного
+        // потока не приводит к выделению памяти больше, чем в потоке есть данных
+        buffer_.clear();
+        for (size_t read = 0u; read < bytes;) {
+            const size_t piece = std::min<size_t>(bytes - read, binary_format::kChunkBytes);
+            buffer_.resize(read + piece);
+            ReadBytes(buffer_.data() + read, piece);
+            read += piece;
+        }
+        offset_ = 0u;
+        remaining_ = count;
+        finished_ = count == 0u;
+    }
+
+    void ReadBytes(void* data, size_t size) {
+        if (!is_.read(static_cast<char*>(data), static_cast<std::streamsize>(size))) {
+            throw std::runtime_error("unexpected end of list");
+        }
+    }
+};
+
+// Запись списка в поток в двоичном формате
+template <typename Type, typename Allocator, typename Stats>
+void WriteBinary(std::ostream& os, const SingleLinkedList<Type, Allocator, Stats>& list) {
+    BinaryListWriter<Type> writer(os);
+    writer.Write(list.begin(), list.end());
+    writer.Finish();
+}
+
+// Чтение списка из потока с добавлением элементов в конец list за O(1) на элемент. Элементы
+// читаются блоками через BinaryListReader::ReadChunk. При ошибке чтения list не меняется
+template <typename Type, typename Allocator, typename Stats>
+void ReadBinary(std::istream& is, SingleLinkedList<Type, Allocator, Stats>& list) {
+    BinaryListReader<Type> reader(is);
+    const auto before = list.cbefore_end();
+    auto pos = before;
+    std::vector<Type> chunk;
+    try {
+        while (reader.ReadChunk(chunk) > 0u) {
+            pos = list.InsertAfter(pos, std::make_move_iterator(chunk.begin()), std::make_move_iterator(chunk.end()));
+        }
+    } catch (...) {
+        list.EraseAfter(before, list.cend());
+        throw;
+    }
+}
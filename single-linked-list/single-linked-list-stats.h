@@ -0,0 +1,93 @@
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+
+// Политики статистики SingleLinkedList (третий параметр шаблона списка).
+// Список вызывает функции политики в горячих путях; у NoListStats все они пустые и встраиваются в ничто,
+// а сама политика хранится как пустой базовый класс, поэтому выключенная статистика ничего не стоит.
+// Статистика относится к объекту списка: при обмене и перемещении списков она остаётся на месте
+
+// Политика без статистики (по умолчанию)
+struct NoListStats {
+    // Метка начала очистки списка
+    struct ClearStart { };
+
+    constexpr void OnNodeAllocated() noexcept { }
+    constexpr void OnNodesFreed(size_t) noexcept { }
+    constexpr void OnTraversal(size_t) noexcept { }
+    constexpr void OnSize(size_t) noexcept { }
+    [[nodiscard]] constexpr ClearStart OnClearBegin() noexcept { return {}; }
+    constexpr void OnClearEnd(ClearStart) noexcept { }
+    constexpr void Merge(const NoListStats&) noexcept { }
+};
+
+// Политика, считающая выделения и освобождения узлов, шаги прохода по списку в PushBack/PopBack,
+// время очисток и пиковый размер списка
+class CountingListStats {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    // Метка начала очистки списка
+    struct ClearStart {
+        Clock::time_point time;
+    };
+
+    // Функции, вызываемые списком
+    void OnNodeAllocated() noexcept { ++node_allocations_; }
+    void OnNodesFreed(size_t count) noexcept { node_frees_ += count; }
+    void OnTraversal(size_t steps) noexcept { traversal_steps_ += steps; }
+    void OnSize(size_t size) noexcept { if (size > peak_size_) peak_size_ = size; }
+    [[nodiscard]] ClearStart OnClearBegin() noexcept { return { Clock::now() }; }
+
+    void OnClearEnd(ClearStart start) noexcept {
+        const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start.time);
+        ++clear_count_;
+        clear_total_ += duration;
+        if (duration > clear_max_) clear_max_ = duration;
+    }
+
+    // Добавление статистики временного списка, созданного списком для своей операции
+    void Merge(const CountingListStats& other) noexcept {
+        node_allocations_ += other.node_allocations_;
+        node_frees_ += other.node_frees_;
+        traversal_steps_ += other.traversal_steps_;
+        OnSize(other.peak_size_);
+        clear_count_ += other.clear_count_;
+        clear_total_ += other.clear_total_;
+        if (other.clear_max_ > clear_max_) clear_max_ = other.clear_max_;
+    }
+
+    // Сброс всех счётчиков
+    void Reset() noexcept { *this = CountingListStats(); }
+
+    // Функции чтения счётчиков
+    [[nodiscard]] size_t GetNodeAllocations() const noexcept { return node_allocations_; }
+    [[nodiscard]] size_t GetNodeFrees()       const noexcept { return node_frees_; }
+    [[nodiscard]] size_t GetTraversalSteps()  const noexcept { return traversal_steps_; }
+    [[nodiscard]] size_t GetPeakSize()        const noexcept { return peak_size_; }
+    [[nodiscard]] size_t GetClearCount()      const noexcept { return clear_count_; }
+    [[nodiscard]] std::chrono::nanoseconds GetClearTotalTime() const noexcept { return clear_total_; }
+    [[nodiscard]] std::chrono::nanoseconds GetClearMaxTime()   const noexcept { return clear_max_; }
+
+private:
+    size_t node_allocations_ = 0u;              // Выделено узлов
+    size_t node_frees_ = 0u;                    // Освобождено узлов
+    size_t traversal_steps_ = 0u;               // Шагов прохода по списку
+    size_t peak_size_ = 0u;                     // Пиковый размер списка
+    size_t clear_count_ = 0u;                   // Количество непустых очисток
+    std::chrono::nanoseconds clear_total_{ 0 }; // Суммарное время очисток
+    std::chrono::nanoseconds clear_max_{ 0 };   // Самая долгая очистка
+};
+
+// Оператор "<<" для вывода статистики в поток
+inline std::ostream& operator << (std::ostream& os, const CountingListStats& stats) {
+    using namespace std::literals;
+    return os << "{allocations: "s << stats.GetNodeAllocations()
+              << ", frees: "s << stats.GetNodeFrees()
+              << ", traversal steps: "s << stats.GetTraversalSteps()
+              << ", peak size: "s << stats.GetPeakSize()
+              << ", clears: "s << stats.GetClearCount()
+              << ", clear total: "s << stats.GetClearTotalTime().count() << " ns"s
+              << ", clear max: "s << stats.GetClearMaxTime().count() << " ns}"s;
+}
@@ -0,0 +1,419 @@
+#pragma once
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#if __cplusplus >= 202002L
+#include <ranges>
+#endif
+
+// Ленивые представления (views) списков и других прямых диапазонов: Filter, Map, Take, Chunk.
+// Представление не копирует элементы и не выделяет память: оно хранит указатель на список (или само
+// вложенное представление) и вычисляет элементы при обходе. Представления соединяются оператором "|":
+//     for (int x : lst | Filter(is_odd) | Map(square) | Take(10)) { ... }
+// Представление действительно, пока жив исходный список и не меняется его состав.
+// Под C++20 представления - это std::ranges::view и сочетаются с std::views (и наоборот)
+
+// Базовый класс представлений списков (под C++20 отмечает их как std::ranges::view)
+struct ListViewBase
+#if __cplusplus >= 202002L
+    : std::ranges::view_base
+#endif
+{ };
+
+// Проверка того, что тип - представление (хранится по значению, а не по указателю)
+template <typename Range>
+inline constexpr bool kIsListView = std::is_base_of_v<ListViewBase, std::remove_cv_t<std::remove_reference_t<Range>>>;
+
+// Тип итератора диапазона Range
+template <typename Range>
+using RangeIterator = decltype(std::begin(std::declval<Range&>()));
+
+// Представление всего диапазона-контейнера (например, списка): хранит указатель на него
+template <typename Range>
+class RefView : public ListViewBase {
+public:
+    RefView() = default;
+    explicit RefView(Range& range) noexcept : range_(std::addressof(range)) { }
+
+    [[nodiscard]] RangeIterator<Range> begin() const { return std::begin(*range_); }
+    [[nodiscard]] RangeIterator<Range> end() const { return std::end(*range_); }
+
+private:
+    Range* range_ = nullptr;
+};
+
+// Представление диапазона: само представление или RefView над контейнером.
+// Временный контейнер не принимается, иначе представление пережило бы его
+template <typename Range>
+auto AllOf(Range&& range) {
+    if constexpr (kIsListView<Range>) {
+        return std::remove_cv_t<std::remove_reference_t<Range>>(std::forward<Range>(range));
+    } else {
+        static_assert(std::is_lvalue_reference_v<Range>, "A view of a temporary container would dangle");
+        return RefView<std::remove_reference_t<Range>>(range);
+    }
+}
+
+template <typename Range>
+using AllOfType = decltype(AllOf(std::declval<Range>()));
+
+// Хранилище функции представления. Лямбды не присваиваются (а с захватом и не создаются по умолчанию),
+// хранилище же копирующе присваивается через пересоздание, чтобы представление оставалось присваиваемым
+template <typename Function>
+class FunctionBox {
+public:
+    FunctionBox() = default;
+    explicit FunctionBox(Function function) : function_(std::move(function)) { }
+
+    FunctionBox(const FunctionBox&) = default;
+    FunctionBox(FunctionBox&&) = default;
+
+    FunctionBox& operator = (const FunctionBox& rhs) {
+        if (this != &rhs) {
+            if (rhs.function_) function_.emplace(*rhs.function_);
+            else               function_.reset();
+        }
+        return *this;
+    }
+
+    FunctionBox& operator = (FunctionBox&& rhs) noexcept(std::is_nothrow_move_constructible_v<Function>) {
+        if (this != &rhs) {
+            if (rhs.function_) function_.emplace(std::move(*rhs.function_));
+            else               function_.reset();
+        }
+        return *this;
+    }
+
+    [[nodiscard]] const Function& operator * () const noexcept {
+        assert(function_);
+        return *function_;
+    }
+
+private:
+    std::optional<Function> function_;
+};
+
+// Представление элементов, удовлетворяющих предикату. begin() ищет первый такой элемент при каждом вызове
+template <typename View, typename Predicate>
+class FilterView : public ListViewBase {
+    using BaseIterator = RangeIterator<const View>;
+
+public:
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = typename std::iterator_traits<BaseIterator>::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::iterator_traits<BaseIterator>::pointer;
+        using reference = typename std::iterator_traits<BaseIterator>::reference;
+
+        Iterator() = default;
+
+        [[nodiscard]] bool operator == (const Iterator& rhs) const { return it_ == rhs.it_; }
+        [[nodiscard]] bool operator != (const Iterator& rhs) const { return !(*this == rhs); }
+
+        Iterator& operator ++ () {
+            ++it_;
+            SkipRejected();
+            return *this;
+        }
+
+        Iterator operator ++ (int) {
+            Iterator tmp(*this);
+            ++(*this);
+            return tmp;
+        }
+
+        [[nodiscard]] reference operator * () const { return *it_; }
+        [[nodiscard]] pointer operator -> () const { return std::addressof(*it_); }
+
+    private:
+        friend class FilterView;
+
+        BaseIterator it_{};
+        BaseIterator end_{};
+        const Predicate* pred_ = nullptr;
+
+        Iterator(BaseIterator it, BaseIterator end, const Predicate* pred) : it_(it), end_(end), pred_(pred) {
+            SkipRejected();
+        }
+
+        // Переход к ближайшему элементу, удовлетворяющему предикату
+        void SkipRejected() {
+            while (it_ != end_ && !std::invoke(*pred_, *it_)) {
+                ++it_;
+            }
+        }
+    };
+
+    FilterView() = default;
+    FilterView(View base, Predicate pred) : base_(std::move(base)), pred_(std::move(pred)) { }
+
+    [[nodiscard]] Iterator begin() const { return Iterator(base_.begin(), base_.end(), &*pred_); }
+    [[nodiscard]] Iterator end() const { return Iterator(base_.end(), base_.end(), &*pred_); }
+
+private:
+    View base_;
+    FunctionBox<Predicate> pred_;
+};
+
+// Представление результатов функции от элементов. Функция вызывается при каждом разыменовании
+template <typename View, typename Function>
+class MapView : public ListViewBase {
+    using BaseIterator = RangeIterator<const View>;
+    using Result = std::invoke_result_t<const Function&, typename std::iterator_traits<BaseIterator>::reference>;
+
+public:
+    class Iterator {
+    public:
+        // Если функция возвращает не ссылку, итератор формально только итератор ввода (C++17),
+        // хотя проходит диапазон многократно (прямой итератор C++20)
+        using iterator_concept = std::forward_iterator_tag;
+        using iterator_category = std::conditional_t<std::is_lvalue_reference_v<Result>, std::forward_iterator_tag, std::input_iterator_tag>;
+        using value_type = std::remove_cv_t<std::remove_reference_t<Result>>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = Result;
+
+        Iterator() = default;
+
+        [[nodiscard]] bool operator == (const Iterator& rhs) const { return it_ == rhs.it_; }
+        [[nodiscard]] bool operator != (const Iterator& rhs) const { return !(*this == rhs); }
+
+        Iterator& operator ++ () {
+            ++it_;
+            return *this;
+        }
+
+        Iterator operator ++ (int) {
+            Iterator tmp(*this);
+            ++(*this);
+            return tmp;
+        }
+
+        [[nodiscard]] reference operator * () const { return std::invoke(*function_, *it_); }
+
+    private:
+        friend class MapView;
+
+        BaseIterator it_{};
+        const Function* function_ = nullptr;
+
+        Iterator(BaseIterator it, const Function* function) : it_(it), function_(function) { }
+    };
+
+    MapView() = default;
+    MapView(View base, Function function) : base_(std::move(base)), function_(std::move(function)) { }
+
+    [[nodiscard]] Iterator begin() const { return Iterator(base_.begin(), &*function_); }
+    [[nodiscard]] Iterator end() const { return Iterator(base_.end(), &*function_); }
+
+private:
+    View base_;
+    FunctionBox<Function> function_;
+};
+
+// Представление не более чем count первых элементов
+template <typename View>
+class TakeView : public ListViewBase {
+    using BaseIterator = RangeIterator<const View>;
+
+public:
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = typename std::iterator_traits<BaseIterator>::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::iterator_traits<BaseIterator>::pointer;
+        using reference = typename std::iterator_traits<BaseIterator>::reference;
+
+        Iterator() = default;
+
+        [[nodiscard]] bool operator == (const Iterator& rhs) const { return it_ == rhs.it_; }
+        [[nodiscard]] bool operator != (const Iterator& rhs) const { return !(*this == rhs); }
+
+        // Когда счётчик исчерпан, итератор переходит в конец исходного диапазона и сравнивается с end().
+        // Исходный итератор при этом не продвигается: у Filter это был бы поиск следующего подходящего
+        // элемента, который всё равно не понадобится
+        Iterator& operator ++ () {
+            assert(count_ > 0u);
+            if (--count_ == 0u) {
+                it_ = end_;
+            } else {
+                ++it_;
+            }
+            return *this;
+        }
+
+        Iterator operator ++ (int) {
+            Iterator tmp(*this);
+            ++(*this);
+            return tmp;
+        }
+
+        [[nodiscard]] reference operator * () const { return *it_; }
+        [[nodiscard]] pointer operator -> () const { return std::addressof(*it_); }
+
+    private:
+        friend class TakeView;
+
+        BaseIterator it_{};
+        BaseIterator end_{};
+        size_t count_ = 0u;
+
+        Iterator(BaseIterator it, BaseIterator end, size_t count) : it_(count > 0u ? it : end), end_(end), count_(count) { }
+    };
+
+    TakeView() = default;
+    TakeView(View base, size_t count) : base_(std::move(base)), count_(count) { }
+
+    [[nodiscard]] Iterator begin() const { return Iterator(base_.begin(), base_.end(), count_); }
+    [[nodiscard]] Iterator end() const { return Iterator(base_.end(), base_.end(), 0u); }
+
+private:
+    View base_;
+    size_t count_ = 0u;
+};
+
+// Интервал [begin; end) - элемент представления Chunk
+template <typename BaseIterator>
+class IteratorRange : public ListViewBase {
+public:
+    IteratorRange() = default;
+    IteratorRange(BaseIterator begin, BaseIterator end) : begin_(begin), end_(end) { }
+
+    [[nodiscard]] BaseIterator begin() const { return begin_; }
+    [[nodiscard]] BaseIterator end() const { return end_; }
+
+private:
+    BaseIterator begin_{};
+    BaseIterator end_{};
+};
+
+// Представление, разбивающее диапазон на последовательные куски по size элементов (последний может быть короче).
+// Переход к следующему куску проходит текущий кусок до конца
+template <typename View>
+class ChunkView : public ListViewBase {
+    using BaseIterator = RangeIterator<const View>;
+
+public:
+    class Iterator {
+    public:
+        using iterator_concept = std::forward_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using value_type = IteratorRange<BaseIterator>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = value_type;
+
+        Iterator() = default;
+
+        [[nodiscard]] bool operator == (const Iterator& rhs) const { return it_ == rhs.it_; }
+        [[nodiscard]] bool operator != (const Iterator& rhs) const { return !(*this == rhs); }
+
+        Iterator& operator ++ () {
+            it_ = chunk_end_;
+            FindChunkEnd();
+            return *this;
+        }
+
+        Iterator operator ++ (int) {
+            Iterator tmp(*this);
+            ++(*this);
+            return tmp;
+        }
+
+        [[nodiscard]] reference operator * () const { return value_type(it_, chunk_end_); }
+
+    private:
+        friend class ChunkView;
+
+        BaseIterator it_{};
+        BaseIterator chunk_end_{};
+        BaseIterator end_{};
+        size_t size_ = 0u;
+
+        Iterator(BaseIterator it, BaseIterator end, size_t size) : it_(it), chunk_end_(it), end_(end), size_(size) {
+            FindChunkEnd();
+        }
+
+        void FindChunkEnd() {
+            chunk_end_ = it_;
+            for (size_t n = size_; n > 0u && chunk_end_ != end_; --n) {
+                ++chunk_end_;
+            }
+        }
+    };
+
+    ChunkView() = default;
+    ChunkView(View base, size_t size) : base_(std::move(base)), size_(size) {
+        assert(size_ > 0u);
+    }
+
+    [[nodiscard]] Iterator begin() const { return Iterator(base_.begin(), base_.end(), size_); }
+    [[nodiscard]] Iterator end() const { return Iterator(base_.end(), base_.end(), size_); }
+
+private:
+    View base_;
+    size_t size_ = 1u;
+};
+
+// Адаптеры для записи через "|": range | Filter(pred) | Map(function) | Take(count) | Chunk(size)
+namespace list_views {
+
+template <typename Predicate>
+struct FilterAdaptor {
+    Predicate pred;
+};
+
+template <typename Function>
+struct MapAdaptor {
+    Function function;
+};
+
+struct TakeAdaptor {
+    size_t count;
+};
+
+struct ChunkAdaptor {
+    size_t size;
+};
+
+template <typename Range, typename Predicate>
+auto operator | (Range&& range, FilterAdaptor<Predicate> adaptor) {
+    return FilterView<AllOfType<Range>, Predicate>(AllOf(std::forward<Range>(range)), std::move(adaptor.pred));
+}
+
+template <typename Range, typename Function>
+auto operator | (Range&& range, MapAdaptor<Function> adaptor) {
+    return MapView<AllOfType<Range>, Function>(AllOf(std::forward<Range>(range)), std::move(adaptor.function));
+}
+
+template <typename Range>
+auto operator | (Range&& range, TakeAdaptor adaptor) {
+    return TakeView<AllOfType<Range>>(AllOf(std::forward<Range>(range)), adaptor.count);
+}
+
+template <typename Range>
+auto operator | (Range&& range, ChunkAdaptor adaptor) {
+    return ChunkView<AllOfType<Range>>(AllOf(std::forward<Range>(range)), adaptor.size);
+}
+
+}  // namespace list_views
+
+// Функции создания адаптеров
+template <typename Predicate>
+list_views::FilterAdaptor<std::decay_t<Predicate>> Filter(Predicate&& pred) { return { std::forward<Predicate>(pred) }; }
+
+template <typename Function>
+list_views::MapAdaptor<std::decay_t<Function>> Map(Function&& function) { return { std::forward<Function>(function) }; }
+
+inline list_views::TakeAdaptor Take(size_t count) { return { count }; }
+
+inline list_views::ChunkAdaptor Chunk(size_t size) { return { size }; }
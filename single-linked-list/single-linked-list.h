@@ -1,19 +1,113 @@
 #pragma once
+#include <algorithm>
 #include <iostream>
 #include <iterator>
 #include <cassert>
+#include <limits>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
 
-// Класс односвязного списка
-template <typename Type>
-class SingleLinkedList {
+#include "single-linked-list-stats.h"
+
+// Основные операции списка объявлены constexpr, если компилятор и стандартная библиотека разрешают
+// выделение памяти в константных выражениях (C++20). Такой список можно построить и обработать при
+// компиляции, но память, выделенная при компиляции, должна быть освобождена там же: наружу выносится
+// результат обработки (число, std::array), а не сам список
+#if defined(__cpp_constexpr_dynamic_alloc) && defined(__cpp_lib_constexpr_dynamic_alloc)
+#define SINGLE_LINKED_LIST_CONSTEXPR constexpr
+#else
+#define SINGLE_LINKED_LIST_CONSTEXPR
+#endif
+
+// Дистанция упреждающей выборки узлов (в узлах) при внутренних проходах по списку: очистке, копировании,
+// сравнении и выводе в поток. 0 выключает упреждающую выборку
+#ifndef SINGLE_LINKED_LIST_PREFETCH_DISTANCE
+#define SINGLE_LINKED_LIST_PREFETCH_DISTANCE 8
+#endif
+
+// Класс односвязного списка. Узлы выделяются аллокатором Allocator (после rebind на тип узла).
+// Stats - политика статистики (см. single-linked-list-stats.h); хранится как пустой базовый класс,
+// чтобы NoListStats не увеличивала размер списка
+template <typename Type, typename Allocator = std::allocator<Type>, typename Stats = NoListStats>
+class SingleLinkedList : private Stats {
 private:
-    // Структура узла списка
-    struct Node {
-        Node() = default;
-        Node(const Type& val, Node* next) : value(val), next_node(next) { }
+    // Базовая структура узла списка: только связь со следующим узлом (из неё состоит фиктивный узел)
+    struct NodeBase {
+        NodeBase* next_node = nullptr;
+    };
+
+    // Структура узла списка. Значение конструируется прямо в узле из переданных аргументов
+    struct Node : NodeBase {
+        template <typename... Args>
+        SINGLE_LINKED_LIST_CONSTEXPR explicit Node(NodeBase* next, Args&&... args) : NodeBase{ next }, value(std::forward<Args>(args)...) { }
+
+        Type value;
+    };
+
+    // Аллокатор узлов и его свойства
+    using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using NodeAllocTraits = std::allocator_traits<NodeAllocator>;
+
+    // Проверка того, что аллокатор умеет освобождать разом все свои узлы (см. NodePoolAllocator)
+    template <typename Alloc, typename = void>
+    struct HasBulkRelease : std::false_type { };
+
+    template <typename Alloc>
+    struct HasBulkRelease<Alloc, std::void_t<
+        decltype(std::declval<const Alloc&>().CanReleaseAll(size_t{})),
+        decltype(std::declval<Alloc&>().ReleaseAll())>> : std::true_type { };
+
+    // Проверка того, что аллокатор умеет заранее резервировать блоки под узлы подряд (см. NodePoolAllocator)
+    template <typename Alloc, typename = void>
+    struct HasBulkReserve : std::false_type { };
+
+    template <typename Alloc>
+    struct HasBulkReserve<Alloc, std::void_t<decltype(std::declval<Alloc&>().Reserve(size_t{}))>> : std::true_type { };
+
+    // Курсор прохода по узлам с упреждающей выборкой. Адрес узла становится известен, только когда
+    // прочитан предыдущий узел, поэтому второй указатель идёт на kPrefetchDistance узлов впереди основного
+    // и запрашивает узлы в кэш: пока основной проход обрабатывает (сравнивает, копирует, освобождает)
+    // текущий узел, промахи по следующим узлам уже обрабатываются
+    class PrefetchingCursor {
+    public:
+        static constexpr size_t kPrefetchDistance = SINGLE_LINKED_LIST_PREFETCH_DISTANCE;
+
+        SINGLE_LINKED_LIST_CONSTEXPR explicit PrefetchingCursor(const NodeBase* node) noexcept : node_(node), ahead_(node) {
+            for (size_t i = 0u; i < kPrefetchDistance && ahead_; ++i) {
+                ahead_ = ahead_->next_node;
+                Prefetch(ahead_);
+            }
+        }
+
+        // Текущий узел (nullptr в конце цепочки)
+        [[nodiscard]] SINGLE_LINKED_LIST_CONSTEXPR const NodeBase* Get() const noexcept { return node_; }
+
+        // Переход к следующему узлу. Следующий узел читается здесь, поэтому текущий после вызова можно освободить
+        SINGLE_LINKED_LIST_CONSTEXPR void Advance() noexcept {
+            assert(node_);
+            node_ = node_->next_node;
+            if constexpr (kPrefetchDistance > 0u) {
+                if (ahead_) {
+                    ahead_ = ahead_->next_node;
+                    Prefetch(ahead_);
+                }
+            }
+        }
+
+    private:
+        const NodeBase* node_;   // Текущий узел
+        const NodeBase* ahead_;  // Узел, запрошенный в кэш последним
 
-        Type value{};
-        Node* next_node = nullptr;
+        static SINGLE_LINKED_LIST_CONSTEXPR void Prefetch([[maybe_unused]] const NodeBase* node) noexcept {
+#if defined(__cpp_lib_is_constant_evaluated)
+            if (std::is_constant_evaluated()) return;
+#endif
+#if defined(__GNUC__) || defined(__clang__)
+            if (node) __builtin_prefetch(node);
+#endif
+        }
     };
 
     // Класс итератора/константного итератора (ValueType=Type/const Type) списка
@@ -34,248 +128,916 @@ private:
         BasicIterator() = default;
 
         // Конструктор копирования
-        BasicIterator(const BasicIterator<Type>& other) noexcept : node_(other.node_) { }
+        SINGLE_LINKED_LIST_CONSTEXPR BasicIterator(const BasicIterator<Type>& other) noexcept : node_(other.node_) { }
 
         // Оператор присваивания
-        BasicIterator& operator = (const BasicIterator& rhs) = default;
+        SINGLE_LINKED_LIST_CONSTEXPR BasicIterator& operator = (const BasicIterator& rhs) = default;
 
         // Операторы сравнения неконстантных итераторов (ValueType = Type)
-        [[nodiscard]] bool operator == (const BasicIterator<Type>& rhs) const noexcept { return node_ == rhs.node_; }
-        [[nodiscard]] bool operator != (const BasicIterator<Type>& rhs) const noexcept { return !(*this == rhs); }
+        [[nodiscard]] SINGLE_LINKED_LIST_CONSTEXPR bool operator == (const BasicIterator<Type>& rhs) const noexcept { return node_ == rhs.node_; }
+        [[nodiscard]] SINGLE_LINKED_LIST_CONSTEXPR bool operator != (const BasicIterator<Type>& rhs) const noexcept { return !(*this == rhs); }
 
         // Операторы сравнения константных итераторов (ValueType = const Type)
-        [[nodiscard]] bool operator == (const BasicIterator<const Type>& rhs) const noexcept { return node_ == rhs.node_; }
-        [[nodiscard]] bool operator != (const BasicIterator<const Type>& rhs) const noexcept { return !(*this == rhs); }
+        [[nodiscard]] SINGLE_LINKED_LIST_CONSTEXPR bool operator == (const BasicIterator<const Type>& rhs) const noexcept { return node_ == rhs.node_; }
+        [[nodiscard]] SINGLE_LINKED_LIST_CONSTEXPR bool operator != (const BasicIterator<const Type>& rhs) const noexcept { return !(*this == rhs); }
 
         // Преинкремент
-        BasicIterator& operator ++ () noexcept {
+        SINGLE_LINKED_LIST_CONSTEXPR BasicIterator& operator ++ () noexcept {
             assert(node_);
             node_ = node_->next_node;
             return *this;
         }
 
         // Постинкремент
-        BasicIterator operator ++ (int) noexcept {
+        SINGLE_LINKED_LIST_CONSTEXPR BasicIterator operator ++ (int) noexcept {
             BasicIterator tmp(*this);
             ++(*this);
             return tmp;
         }
 
         // Оператор разыменовывания
-        [[nodiscard]] reference operator * () const noexcept {
+        [[nodiscard]] SINGLE_LINKED_LIST_CONSTEXPR reference operator * () const noexcept {
             assert(node_);
-            return node_->value;
+            return static_cast<Node*>(node_)->value;
         }
 
         // Оператор доступа к членам
-        [[nodiscard]] pointer operator -> () const noexcept {
+        [[nodiscard]] SINGLE_LINKED_LIST_CONSTEXPR pointer operator -> () const noexcept {
             assert(node_);
-            return &(node_->value);
+            return &(static_cast<Node*>(node_)->value);
         }
 
     private:
         // Указатель на узел
-        Node* node_ = nullptr;
+        NodeBase* node_ = nullptr;
 
         // Конструктор, создающий итератор из указателя на узел (используется в классе списка)
-        explicit BasicIterator(Node* node) : node_(node) { }
+        SINGLE_LINKED_LIST_CONSTEXPR explicit BasicIterator(NodeBase* node) : node_(node) { }
     };
 
 public:
     // Конструктор по умолчанию создаёт пустой список
-    SingleLinkedList() noexcept = default;
+    SINGLE_LINKED_LIST_CONSTEXPR SingleLinkedList() noexcept(std::is_nothrow_default_constructible_v<NodeAllocator>) = default;
+
+    // Конструктор, создающий пустой список с заданным аллокатором
+    SINGLE_LINKED_LIST_CONSTEXPR explicit SingleLinkedList(const Allocator& alloc) noexcept : node_alloc_(alloc) { }
 
     // Конструктор, создающий список из элементов std::initializer_list
-    SingleLinkedList(std::initializer_list<Type> values) {
+    SINGLE_LINKED_LIST_CONSTEXPR SingleLinkedList(std::initializer_list<Type> values, const Allocator& alloc = Allocator()) : node_alloc_(alloc) {
         CopyAndSwapFromIteratorRage(values.begin(), values.end());
     }
 
+    // Конструктор, создающий список из элементов интервала [first; last) за один проход
+    // (подходит и для однопроходных итераторов ввода, например чтения из потока)
+    template <typename InputIterator, typename = std::enable_if_t<std::is_convertible_v<
+        typename std::iterator_traits<InputIterator>::iterator_category, std::input_iterator_tag>>>
+    SINGLE_LINKED_LIST_CONSTEXPR SingleLinkedList(InputIterator first, InputIterator last, const Allocator& alloc = Allocator()) : node_alloc_(alloc) {
+        CopyAndSwapFromIteratorRage(first, last);
+    }
+
     // Конструктор копирования
-    SingleLinkedList(const SingleLinkedList& other) {
-        CopyAndSwapFromIteratorRage(other.begin(), other.end());
+    SINGLE_LINKED_LIST_CONSTEXPR SingleLinkedList(const SingleLinkedList& other)
+        : node_alloc_(NodeAllocTraits::select_on_container_copy_construction(other.node_alloc_)) {
+        CopyAndSwapFromIteratorRage(other.begin(), other.end(), other.size_);
+    }
+
+    // Конструктор перемещения: узлы переходят к новому списку без копирования (статистика не переходит)
+    SINGLE_LINKED_LIST_CONSTEXPR SingleLinkedList(SingleLinkedList&& other) noexcept : node_alloc_(std::move(other.node_alloc_)) {
+        SwapNodes(other);
     }
 
     // Деструктор
-    ~SingleLinkedList() noexcept { Clear(); }
+    SINGLE_LINKED_LIST_CONSTEXPR ~SingleLinkedList() noexcept { Clear(); }
 
-    // Оператор присваивания
-    SingleLinkedList& operator = (const SingleLinkedList& rhs) {
+    // Оператор присваивания. Если копирующее присваивание элементов не выбрасывает исключений и узлы
+    // остаются у того же аллокатора, существующие узлы переиспользуются: значения перезаписываются на месте,
+    // выделяется или освобождается только разница в размерах. Иначе список собирается заново в новых узлах,
+    // которые выделяет аллокатор, остающийся у списка после присваивания. В обоих случаях при исключении
+    // список не меняется
+    SINGLE_LINKED_LIST_CONSTEXPR SingleLinkedList& operator = (const SingleLinkedList& rhs) {
         if (this != &rhs) {
-            SingleLinkedList<Type> rhs_copy(rhs);
-            this->swap(rhs_copy);
+            if constexpr (std::is_nothrow_copy_assignable_v<Type>) {
+                if (!NodeAllocTraits::propagate_on_container_copy_assignment::value || node_alloc_ == rhs.node_alloc_) {
+                    AssignRecycling(rhs.cbegin(), rhs.size_);
+                    return *this;
+                }
+            }
+            SingleLinkedList rhs_copy(NodeAllocTraits::propagate_on_container_copy_assignment::value
+                                      ? rhs.node_alloc_ : node_alloc_);
+            rhs_copy.CopyAndSwapFromIteratorRage(rhs.begin(), rhs.end(), rhs.size_);
+            this->SwapWithAllocator(rhs_copy);
+            rhs_copy.Clear();
+            GetStatsRef().Merge(rhs_copy.GetStats());
         }
         return *this;
     }
 
+    // Оператор перемещающего присваивания. Если узлы rhs нельзя забрать (аллокаторы не равны и
+    // не распространяются при перемещении), элементы перемещаются поэлементно в новые узлы
+    SINGLE_LINKED_LIST_CONSTEXPR SingleLinkedList& operator = (SingleLinkedList&& rhs)
+        noexcept(NodeAllocTraits::propagate_on_container_move_assignment::value || NodeAllocTraits::is_always_equal::value) {
+        if (this == &rhs) {
+            return *this;
+        }
+        if constexpr (NodeAllocTraits::propagate_on_container_move_assignment::value) {
+            Clear();
+            node_alloc_ = std::move(rhs.node_alloc_);
+        } else if (node_alloc_ == rhs.node_alloc_) {
+            Clear();
+        } else {
+            CopyAndSwapFromIteratorRage(std::make_move_iterator(rhs.begin()), std::make_move_iterator(rhs.end()));
+            rhs.Clear();
+            return *this;
+        }
+        SwapNodes(rhs);
+        return *this;
+    }
+
+    // Функция замены содержимого списка элементами интервала [first; last) с переиспользованием существующих
+    // узлов (см. оператор присваивания). Переиспользование требует прямых итераторов, не выбрасывающих
+    // исключений, и присваивания элементов без исключений; иначе список собирается заново.
+    // При исключении список не меняется
+    template <typename InputIterator, typename = std::enable_if_t<std::is_convertible_v<
+        typename std::iterator_traits<InputIterator>::iterator_category, std::input_iterator_tag>>>
+    SINGLE_LINKED_LIST_CONSTEXPR void Assign(InputIterator first, InputIterator last) {
+        if constexpr (std::is_convertible_v<typename std::iterator_traits<InputIterator>::iterator_category, std::forward_iterator_tag>
+                      && std::is_nothrow_assignable_v<Type&, typename std::iterator_traits<InputIterator>::reference>
+                      && noexcept(++std::declval<InputIterator&>()) && noexcept(*std::declval<InputIterator&>())) {
+            AssignRecycling(first, static_cast<size_t>(std::distance(first, last)));
+        } else {
+            CopyAndSwapFromIteratorRage(first, last);
+        }
+    }
+
+    SINGLE_LINKED_LIST_CONSTEXPR void Assign(std::initializer_list<Type> values) { Assign(values.begin(), values.end()); }
+
+    // Функция замены содержимого списка count копиями value с переиспользованием существующих узлов
+    SINGLE_LINKED_LIST_CONSTEXPR void Assign(size_t count, const Type& value) {
+        if constexpr (std::is_nothrow_copy_assignable_v<Type>) {
+            SingleLinkedList tail(node_alloc_);
+            for (size_t i = size_; i < count; ++i) {
+                tail.AppendNode(value);
+            }
+            tail.GetStatsRef().OnSize(tail.size_);
+
+            NodeBase* node = &head_;
+            for (size_t i = 0u; i < count && node->next_node; ++i) {
+                node = node->next_node;
+                static_cast<Node*>(node)->value = value;
+            }
+            ReplaceAfter(node, tail);
+        } else {
+            SingleLinkedList tmp(node_alloc_);
+            for (size_t i = 0u; i < count; ++i) {
+                tmp.AppendNode(value);
+            }
+            tmp.GetStatsRef().OnSize(tmp.size_);
+            this->swap(tmp);
+            tmp.Clear();
+            GetStatsRef().Merge(tmp.GetStats());
+        }
+    }
+
+    // Функция изменения размера списка: лишние элементы в конце удаляются, недостающие создаются
+    // конструктором по умолчанию (или копированием value) и добавляются в конец. Новые узлы сначала
+    // собираются в отдельную цепочку, поэтому при исключении список не меняется
+    SINGLE_LINKED_LIST_CONSTEXPR void Resize(size_t count) { ResizeWith(count); }
+    SINGLE_LINKED_LIST_CONSTEXPR void Resize(size_t count, const Type& value) { ResizeWith(count, value); }
+
     // Псевдонимы для типов, ссылок, константных ссылок, итераторов и константных итераторов
     using value_type = Type;
+    using allocator_type = Allocator;
     using reference = value_type&;
     using const_reference = const value_type&;
 
     using Iterator      = BasicIterator<Type>;
     using ConstIterator = BasicIterator<const Type>;
 
+    // Связь узла списка (поле next_node) для цепочек узлов, созданных CreateDetachedNode
+    using NodeLink = NodeBase;
+
     // Итераторы, указывающие на начало, конец и фиктивный узел списка
-    [[nodiscard]] Iterator begin()        noexcept { return Iterator(head_.next_node); }
-    [[nodiscard]] Iterator end()          noexcept { return Iterator(nullptr); }
-    [[nodiscard]] Iterator before_begin() noexcept { return Iterator(&head_); }
+    [[nodiscard]] SINGLE_LINKED_LIST_CONSTEXPR Iterator begin()        noexcept { return Iterator(head_.next_node); }
+    [[nodiscard]] SINGLE_LINKED_LIST_CONSTEXPR Iterator end()          noexcept { return Iterator(nullptr); }
+    [[nodiscard]] SINGLE_LINKED_LIST_CONSTEXPR Iterator before_begin() noexcept { return Iterator(&head_); }
+
+    // Итератор, указывающий на последний элемент списка (на фиктивный узел, если список пуст)
+    [[nodiscard]] SINGLE_LINKED_LIST_CONSTEXPR Iterator      before_end()        noexcept { return Iterator(tail_); }
+    [[nodiscard]] SINGLE_LINKED_LIST_CONSTEXPR ConstIterator before_end()  const noexcept { return cbefore_end(); }
+    [[nodiscard]] SINGLE_LINKED_LIST_CONSTEXPR ConstIterator cbefore_end() const noexcept { return Iterator(tail_); }
 
     // Константные итераторы, указывающие на начало, конец и фиктивный узел списка
-    [[nodiscard]] ConstIterator begin()        const noexcept { return cbegin(); }
-    [[nodiscard]] ConstIterator end()          const noexcept { return cend(); }
-    [[nodiscard]] ConstIterator before_begin() const noexcept { return cbefore_begin(); }
+    [[nodiscard]] SINGLE_LINKED_LIST_CONSTEXPR ConstIterator begin()        const noexcept { return cbegin(); }
+    [[nodiscard]] SINGLE_LINKED_LIST_CONSTEXPR ConstIterator end()          const noexcept { return cend(); }
+    [[nodiscard]] SINGLE_LINKED_LIST_CONSTEXPR ConstIterator before_begin() const noexcept { return cbefore_begin(); }
 
-    [[nodiscard]] ConstIterator cbegin()        const noexcept { return Iterator(const_cast<Node*>(head_.next_node)); }
-    [[nodiscard]] ConstIterator cend()          const noexcept { return Iterator(nullptr); }
-    [[nodiscard]] ConstIterator cbefore_begin() const noexcept { return Iterator(const_cast<Node*>(&head_)); }
+    [[nodiscard]] SINGLE_LINKED_LIST_CONSTEXPR ConstIterator cbegin()        const noexcept { return Iterator(head_.next_node); }
+    [[nodiscard]] SINGLE_LINKED_LIST_CONSTEXPR ConstIterator cend()          const noexcept { return Iterator(nullptr); }
+    [[nodiscard]] SINGLE_LINKED_LIST_CONSTEXPR ConstIterator cbefore_begin() const noexcept { return Iterator(const_cast<NodeBase*>(&head_)); }
 
-    // Функция обмена с другим списком
-    void swap(SingleLinkedList& other) noexcept {
-        std::swap(head_.next_node, other.head_.next_node);
-        std::swap(size_, other.size_);
+    // Функция обмена с другим списком. Аллокаторы обмениваются, только если этого требует
+    // propagate_on_container_swap; иначе аллокаторы списков должны быть равны
+    SINGLE_LINKED_LIST_CONSTEXPR void swap(SingleLinkedList& other) noexcept {
+        if constexpr (NodeAllocTraits::propagate_on_container_swap::value) {
+            SwapWithAllocator(other);
+        } else {
+            assert(node_alloc_ == other.node_alloc_);
+            SwapNodes(other);
+        }
     }
 
+    // Функция получения копии аллокатора
+    [[nodiscard]] SINGLE_LINKED_LIST_CONSTEXPR allocator_type get_allocator() const noexcept { return allocator_type(node_alloc_); }
+
+    // Функция получения статистики списка
+    [[nodiscard]] SINGLE_LINKED_LIST_CONSTEXPR const Stats& GetStats() const noexcept { return *this; }
+
     // Функция получения размера
-    [[nodiscard]] size_t GetSize() const noexcept { return size_; }
+    [[nodiscard]] SINGLE_LINKED_LIST_CONSTEXPR size_t GetSize() const noexcept { return size_; }
 
     // Функция проверки на пустоту
-    [[nodiscard]] bool IsEmpty() const noexcept { return size_ == 0u; }
+    [[nodiscard]] SINGLE_LINKED_LIST_CONSTEXPR bool IsEmpty() const noexcept { return size_ == 0u; }
+
+    // Функции доступа к первому и последнему элементам списка
+    [[nodiscard]] SINGLE_LINKED_LIST_CONSTEXPR reference       front()       noexcept { assert(!IsEmpty()); return *begin(); }
+    [[nodiscard]] SINGLE_LINKED_LIST_CONSTEXPR const_reference front() const noexcept { assert(!IsEmpty()); return *cbegin(); }
+    [[nodiscard]] SINGLE_LINKED_LIST_CONSTEXPR reference       back()        noexcept { assert(!IsEmpty()); return static_cast<Node*>(tail_)->value; }
+    [[nodiscard]] SINGLE_LINKED_LIST_CONSTEXPR const_reference back()  const noexcept { assert(!IsEmpty()); return static_cast<const Node*>(tail_)->value; }
 
     // Функция добавления в начало списка
-    void PushFront(const Type& value) {
-        head_.next_node = new Node(value, head_.next_node);
-        ++size_;
+    SINGLE_LINKED_LIST_CONSTEXPR void PushFront(const Type& value) { EmplaceFront(value); }
+    SINGLE_LINKED_LIST_CONSTEXPR void PushFront(Type&& value) { EmplaceFront(std::move(value)); }
+
+    // Функция создания элемента в начале списка из аргументов конструктора Type
+    template <typename... Args>
+    SINGLE_LINKED_LIST_CONSTEXPR reference EmplaceFront(Args&&... args) {
+        Node* node = CreateNode(head_.next_node, std::forward<Args>(args)...);
+        if (!head_.next_node) tail_ = node;
+        head_.next_node = node;
+        GetStatsRef().OnSize(++size_);
+        return node->value;
     }
 
     // Функция удаления из начала списка
-    void PopFront() noexcept {
+    SINGLE_LINKED_LIST_CONSTEXPR void PopFront() noexcept {
         assert(!IsEmpty());
 
-        Node* tmp = head_.next_node->next_node;
-        delete head_.next_node;
+        NodeBase* tmp = head_.next_node->next_node;
+        DestroyNode(head_.next_node);
         head_.next_node = tmp;
+        if (!tmp) tail_ = &head_;
         --size_;
     }
 
-    // Функция добавления в конец списка
-    // Это не просили делать, но пусть будет (в остальных методах не используется)
-    void PushBack(const Type& value) {
-        Node* back = &head_;
-        while (back->next_node) { back = back->next_node;}
+    // Функция добавления в конец списка за O(1) (после последнего узла tail_)
+    SINGLE_LINKED_LIST_CONSTEXPR void PushBack(const Type& value) { EmplaceBack(value); }
+    SINGLE_LINKED_LIST_CONSTEXPR void PushBack(Type&& value) { EmplaceBack(std::move(value)); }
 
-        back->next_node = new Node(value, nullptr);
-        ++size_;
+    // Функция создания элемента в конце списка из аргументов конструктора Type
+    template <typename... Args>
+    SINGLE_LINKED_LIST_CONSTEXPR reference EmplaceBack(Args&&... args) {
+        Node* node = CreateNode(nullptr, std::forward<Args>(args)...);
+        tail_->next_node = node;
+        tail_ = node;
+        GetStatsRef().OnSize(++size_);
+        return node->value;
     }
 
-    // Функция удаления из конца списка
-    // Это не просили делать, но пусть будет (в остальных методах не используется)
-    void PopBack() noexcept  {
+    // Функция удаления из конца списка. Односвязный список не знает предпоследний узел,
+    // поэтому удаление требует прохода по списку за O(n)
+    SINGLE_LINKED_LIST_CONSTEXPR void PopBack() noexcept  {
         assert(!IsEmpty());
 
-        Node* pre_back = &head_;
-        while (pre_back->next_node->next_node) { pre_back = pre_back->next_node; }
+        NodeBase* pre_back = &head_;
+        size_t steps = 0u;
+        while (pre_back->next_node->next_node) { pre_back = pre_back->next_node; ++steps; }
+        GetStatsRef().OnTraversal(steps);
 
-        delete pre_back->next_node;
+        DestroyNode(pre_back->next_node);
         pre_back->next_node = nullptr;
+        tail_ = pre_back;
         --size_;
     }
 
     // Функция добавления после элемента, на который указывает итератор
-    Iterator InsertAfter(ConstIterator pos, const Type& value) {
+    SINGLE_LINKED_LIST_CONSTEXPR Iterator InsertAfter(ConstIterator pos, const Type& value) { return EmplaceAfter(pos, value); }
+    SINGLE_LINKED_LIST_CONSTEXPR Iterator InsertAfter(ConstIterator pos, Type&& value) { return EmplaceAfter(pos, std::move(value)); }
+
+    // Функция создания элемента после элемента, на который указывает итератор, из аргументов конструктора Type
+    template <typename... Args>
+    SINGLE_LINKED_LIST_CONSTEXPR Iterator EmplaceAfter(ConstIterator pos, Args&&... args) {
         assert(pos.node_);
 
-        pos.node_->next_node = new Node(value, pos.node_->next_node);
-        ++size_;
+        pos.node_->next_node = CreateNode(pos.node_->next_node, std::forward<Args>(args)...);
+        if (pos.node_ == tail_) tail_ = pos.node_->next_node;
+        GetStatsRef().OnSize(++size_);
         return Iterator(pos.node_->next_node);
     }
 
     // Функция удаления после элемента, на который указывает итератор
-    Iterator EraseAfter(ConstIterator pos) noexcept {
+    SINGLE_LINKED_LIST_CONSTEXPR Iterator EraseAfter(ConstIterator pos) noexcept {
         assert(pos.node_);
         assert(pos.node_->next_node);
 
-        Node* tmp = pos.node_->next_node->next_node;
-        delete pos.node_->next_node;
+        NodeBase* tmp = pos.node_->next_node->next_node;
+        if (pos.node_->next_node == tail_) tail_ = pos.node_;
+        DestroyNode(pos.node_->next_node);
         pos.node_->next_node = tmp;
         --size_;
 
         return Iterator(tmp);
     }
 
-    // Очистка списка
-    void Clear() noexcept {
-        while (head_.next_node) {
-            Node* tmp = head_.next_node->next_node;
-            delete head_.next_node;
-            head_.next_node = tmp;
+    // Функция удаления элементов в интервале (first; last). Возвращает last
+    SINGLE_LINKED_LIST_CONSTEXPR Iterator EraseAfter(ConstIterator first, ConstIterator last) noexcept {
+        assert(first.node_);
+
+        NodeBase* node = first.node_->next_node;
+        first.node_->next_node = last.node_;
+        if (!last.node_) tail_ = first.node_;
+
+        size_t erased = 0u;
+        while (node != last.node_) {
+            assert(node);
+            NodeBase* tmp = node->next_node;
+            DestroyNode(node);
+            node = tmp;
+            ++erased;
+        }
+        size_ -= erased;
+
+        return Iterator(last.node_);
+    }
+
+    // Функция добавления копий элементов интервала [first; last) после элемента, на который указывает итератор.
+    // Возвращает итератор на последний добавленный элемент (или pos, если интервал пуст).
+    // Элементы сначала копируются во временную цепочку, поэтому при исключении список не меняется
+    template <typename InputIterator>
+    SINGLE_LINKED_LIST_CONSTEXPR Iterator InsertAfter(ConstIterator pos, InputIterator first, InputIterator last) {
+        SingleLinkedList inserted(node_alloc_);
+        for (; first != last; ++first) {
+            inserted.EmplaceBack(*first);
+        }
+        if (inserted.IsEmpty()) {
+            return Iterator(pos.node_);
+        }
+
+        NodeBase* inserted_back = inserted.tail_;
+        SpliceAfter(pos, inserted);
+        GetStatsRef().Merge(inserted.GetStats());
+        return Iterator(inserted_back);
+    }
+
+    // Функция переноса всех элементов списка other после элемента, на который указывает итератор.
+    // Узлы перецепляются за O(1), other становится пустым. Аллокаторы списков должны быть равны
+    SINGLE_LINKED_LIST_CONSTEXPR void SpliceAfter(ConstIterator pos, SingleLinkedList& other) noexcept {
+        assert(pos.node_);
+        assert(this != &other);
+        assert(node_alloc_ == other.node_alloc_);
+        if (other.IsEmpty()) {
+            return;
+        }
+
+        LinkChainAfter(pos.node_, other.head_.next_node, other.tail_);
+        size_ += other.size_;
+        GetStatsRef().OnSize(size_);
+
+        other.head_.next_node = nullptr;
+        other.tail_ = &other.head_;
+        other.size_ = 0u;
+    }
+
+    SINGLE_LINKED_LIST_CONSTEXPR void SpliceAfter(ConstIterator pos, SingleLinkedList&& other) noexcept { SpliceAfter(pos, other); }
+
+    // Функция переноса элемента, следующего за it в списке other (возможно, в этом же списке),
+    // после элемента, на который указывает pos
+    SINGLE_LINKED_LIST_CONSTEXPR void SpliceAfter(ConstIterator pos, SingleLinkedList& other, ConstIterator it) noexcept {
+        assert(pos.node_);
+        assert(it.node_ && it.node_->next_node);
+        assert(node_alloc_ == other.node_alloc_);
+
+        NodeBase* node = it.node_->next_node;
+        if (pos.node_ == it.node_ || pos.node_ == node) {
+            return;
+        }
+
+        it.node_->next_node = node->next_node;
+        if (other.tail_ == node) other.tail_ = it.node_;
+        --other.size_;
+
+        LinkChainAfter(pos.node_, node, node);
+        GetStatsRef().OnSize(++size_);
+    }
+
+    SINGLE_LINKED_LIST_CONSTEXPR void SpliceAfter(ConstIterator pos, SingleLinkedList&& other, ConstIterator it) noexcept { SpliceAfter(pos, other, it); }
+
+    // Функция переноса элементов интервала (first; last) списка other (возможно, этого же списка, но тогда
+    // pos не должен лежать в интервале) после элемента, на который указывает pos. Узлы перецепляются,
+    // размеры списков обновляются один раз за перенос. Требует прохода по интервалу для поиска его конца
+    SINGLE_LINKED_LIST_CONSTEXPR void SpliceAfter(ConstIterator pos, SingleLinkedList& other, ConstIterator first, ConstIterator last) noexcept {
+        assert(pos.node_);
+        assert(first.node_);
+        assert(node_alloc_ == other.node_alloc_);
+
+        NodeBase* chain_front = first.node_->next_node;
+        if (chain_front == last.node_ || pos.node_ == first.node_) {
+            return;
+        }
+
+        size_t count = 1u;
+        NodeBase* chain_back = chain_front;
+        while (chain_back->next_node != last.node_) {
+            assert(chain_back != pos.node_);
+            chain_back = chain_back->next_node;
+            ++count;
+        }
+        assert(chain_back != pos.node_);
+
+        first.node_->next_node = last.node_;
+        if (other.tail_ == chain_back) other.tail_ = first.node_;
+        other.size_ -= count;
+
+        LinkChainAfter(pos.node_, chain_front, chain_back);
+        size_ += count;
+        GetStatsRef().OnSize(size_);
+    }
+
+    SINGLE_LINKED_LIST_CONSTEXPR void SpliceAfter(ConstIterator pos, SingleLinkedList&& other, ConstIterator first, ConstIterator last) noexcept {
+        SpliceAfter(pos, other, first, last);
+    }
+
+    // Функция получения неконстантного итератора по константному итератору этого списка за O(1)
+    // (как erase_after(pos, pos) у std::forward_list). Нужен неконстантный список, поэтому константность
+    // элементов не обходится: контейнеры поверх списка могут хранить константные итераторы
+    [[nodiscard]] SINGLE_LINKED_LIST_CONSTEXPR Iterator MakeMutable(ConstIterator pos) noexcept { return Iterator(pos.node_); }
+
+    // Функция создания узла вне списка (next_node равен nullptr) с элементом из аргументов конструктора Type.
+    // Узел не принадлежит ни одному списку, пока не передан в AdoptChainAfter. Нужна контейнерам, которые
+    // сами связывают узлы в цепочку (например, MpscQueue из нескольких потоков)
+    template <typename... Args>
+    [[nodiscard]] static NodeLink* CreateDetachedNode(const Allocator& alloc, Args&&... args) {
+        NodeAllocator node_alloc(alloc);
+        Node* node = NodeAllocTraits::allocate(node_alloc, 1u);
+        try {
+            NodeAllocTraits::construct(node_alloc, node, nullptr, std::forward<Args>(args)...);
+        } catch (...) {
+            NodeAllocTraits::deallocate(node_alloc, node, 1u);
+            throw;
+        }
+        return node;
+    }
+
+    // Функция передачи списку цепочки [front; back] из count узлов, созданных CreateDetachedNode с аллокатором,
+    // равным аллокатору списка, и связанных через next_node. Цепочка подцепляется после pos за O(1)
+    SINGLE_LINKED_LIST_CONSTEXPR void AdoptChainAfter(ConstIterator pos, NodeLink* front, NodeLink* back, size_t count) noexcept {
+        assert(pos.node_ && front && back && count > 0u);
+        LinkChainAfter(pos.node_, front, back);
+        size_ += count;
+        GetStatsRef().OnSize(size_);
+    }
+
+    // Очистка списка. Если элементы не требуют разрушения, а аллокатор умеет освобождать все свои узлы разом
+    // и все они принадлежат этому списку, узлы не обходятся вовсе
+    SINGLE_LINKED_LIST_CONSTEXPR void Clear() noexcept {
+        if (size_ == 0u) {
+            return;
+        }
+        const auto clear_start = GetStatsRef().OnClearBegin();
+
+        if constexpr (std::is_trivially_destructible_v<Node> && HasBulkRelease<NodeAllocator>::value) {
+            if (node_alloc_.CanReleaseAll(size_)) {
+                node_alloc_.ReleaseAll();
+                GetStatsRef().OnNodesFreed(size_);
+                head_.next_node = nullptr;
+                tail_ = &head_;
+                size_ = 0u;
+                GetStatsRef().OnClearEnd(clear_start);
+                return;
+            }
         }
 
+        for (PrefetchingCursor cursor(head_.next_node); cursor.Get();) {
+            NodeBase* node = const_cast<NodeBase*>(cursor.Get());
+            cursor.Advance();
+            DestroyNode(node);
+        }
+
+        head_.next_node = nullptr;
+        tail_ = &head_;
         size_ = 0u;
+        GetStatsRef().OnClearEnd(clear_start);
+    }
+
+    // Сортировка списка слиянием снизу вверх за O(n log n). Узлы перецепляются, значения не копируются
+    // и не перемещаются, дополнительная память не выделяется. Сортировка устойчива.
+    // Отсортированные цепочки из 2^i узлов копятся в buckets[i] (как разряды двоичного счётчика), поэтому
+    // небольшие слияния идут по недавно прочитанным узлам, а не отдельными проходами по всему списку.
+    // Если comp выбросит исключение, список сохранит все элементы в неуказанном порядке
+    template <typename Compare = std::less<>>
+    SINGLE_LINKED_LIST_CONSTEXPR void Sort(Compare comp = Compare()) {
+        if (size_ < 2u) {
+            return;
+        }
+
+        NodeBase* buckets[std::numeric_limits<size_t>::digits] = {};
+        NodeBase merged;
+        NodeBase* carry = nullptr;
+        NodeBase* last = nullptr;
+        NodeBase* rest = head_.next_node;
+        head_.next_node = nullptr;
+
+        // Функция слияния более ранней цепочки left с carry (результат снова в carry)
+        const auto merge_into_carry = [&](NodeBase* left) {
+            NodeBase* right = std::exchange(carry, nullptr);
+            last = MergeChains(&merged, left, right, comp);
+            carry = std::exchange(merged.next_node, nullptr);
+        };
+
+        try {
+            while (rest) {
+                carry = rest;
+                rest = rest->next_node;
+                carry->next_node = nullptr;
+
+                size_t i = 0u;
+                for (; buckets[i]; ++i) {
+                    merge_into_carry(std::exchange(buckets[i], nullptr));
+                }
+                buckets[i] = std::exchange(carry, nullptr);
+            }
+
+            last = nullptr;
+            for (NodeBase*& bucket : buckets) {
+                if (!bucket) continue;
+                if (carry) {
+                    merge_into_carry(std::exchange(bucket, nullptr));
+                } else {
+                    carry = std::exchange(bucket, nullptr);
+                }
+            }
+        } catch (...) {
+            // Все цепочки сцепляются обратно в список
+            NodeBase* back = &head_;
+            for (NodeBase* chain : { merged.next_node, carry, rest }) {
+                back->next_node = chain;
+                back = FindLast(back);
+            }
+            for (NodeBase* chain : buckets) {
+                back->next_node = chain;
+                back = FindLast(back);
+            }
+            tail_ = back;
+            throw;
+        }
+
+        head_.next_node = carry;
+        tail_ = last ? last : FindLast(&head_);
+    }
+
+    // Слияние с отсортированным списком other (текущий список тоже должен быть отсортирован).
+    // Узлы other перецепляются в текущий список, other становится пустым. Аллокаторы списков должны быть равны
+    template <typename Compare = std::less<>>
+    SINGLE_LINKED_LIST_CONSTEXPR void Merge(SingleLinkedList& other, Compare comp = Compare()) {
+        if (this == &other || other.IsEmpty()) {
+            return;
+        }
+        assert(node_alloc_ == other.node_alloc_);
+
+        // При исключении в comp все узлы уже подцеплены к текущему списку в неуказанном порядке
+        NodeBase* left = head_.next_node;
+        NodeBase* right = other.head_.next_node;
+        size_ += other.size_;
+        GetStatsRef().OnSize(size_);
+        other.head_.next_node = nullptr;
+        other.tail_ = &other.head_;
+        other.size_ = 0u;
+        try {
+            tail_ = MergeChains(&head_, left, right, comp);
+        } catch (...) {
+            tail_ = FindLast(&head_);
+            throw;
+        }
+    }
+
+    template <typename Compare = std::less<>>
+    SINGLE_LINKED_LIST_CONSTEXPR void Merge(SingleLinkedList&& other, Compare comp = Compare()) { Merge(other, comp); }
+
+    // Удаление подряд идущих эквивалентных элементов (кроме первого из них). Возвращает количество удалённых элементов
+    template <typename BinaryPredicate = std::equal_to<>>
+    SINGLE_LINKED_LIST_CONSTEXPR size_t Unique(BinaryPredicate pred = BinaryPredicate()) {
+        const size_t old_size = size_;
+        if (size_ < 2u) {
+            return 0u;
+        }
+
+        NodeBase* kept = head_.next_node;
+        while (kept->next_node) {
+            if (pred(static_cast<Node*>(kept)->value, static_cast<Node*>(kept->next_node)->value)) {
+                NodeBase* tmp = kept->next_node->next_node;
+                DestroyNode(kept->next_node);
+                kept->next_node = tmp;
+                --size_;
+            } else {
+                kept = kept->next_node;
+            }
+        }
+        tail_ = kept;
+
+        return old_size - size_;
+    }
+
+    // Разворот списка перецеплением узлов
+    SINGLE_LINKED_LIST_CONSTEXPR void Reverse() noexcept {
+        NodeBase* reversed = nullptr;
+        NodeBase* rest = head_.next_node;
+        if (rest) {
+            tail_ = rest;
+        }
+
+        while (rest) {
+            NodeBase* tmp = rest->next_node;
+            rest->next_node = reversed;
+            reversed = rest;
+            rest = tmp;
+        }
+        head_.next_node = reversed;
+    }
+
+    // Удаление всех элементов, удовлетворяющих предикату. Возвращает количество удалённых элементов
+    template <typename UnaryPredicate>
+    SINGLE_LINKED_LIST_CONSTEXPR size_t RemoveIf(UnaryPredicate pred) {
+        const size_t old_size = size_;
+
+        NodeBase* prev = &head_;
+        while (prev->next_node) {
+            if (pred(static_cast<Node*>(prev->next_node)->value)) {
+                NodeBase* tmp = prev->next_node->next_node;
+                DestroyNode(prev->next_node);
+                prev->next_node = tmp;
+                --size_;
+            } else {
+                prev = prev->next_node;
+            }
+        }
+        tail_ = prev;
+
+        return old_size - size_;
     }
 
 private:
-    Node head_;        // Фиктивный узел
-    size_t size_ = 0u; // Размер списка
+    // Сравнения и вывод в поток проходят по узлам напрямую, с упреждающей выборкой
+    template <typename T, typename A, typename S>
+    friend SINGLE_LINKED_LIST_CONSTEXPR bool operator == (const SingleLinkedList<T, A, S>& lhs, const SingleLinkedList<T, A, S>& rhs);
+    template <typename T, typename A, typename S>
+    friend SINGLE_LINKED_LIST_CONSTEXPR bool operator < (const SingleLinkedList<T, A, S>& lhs, const SingleLinkedList<T, A, S>& rhs);
+    template <typename T, typename A, typename S>
+    friend std::ostream& operator << (std::ostream& os, const SingleLinkedList<T, A, S>& single_linked_list);
+
+    NodeBase head_;             // Фиктивный узел
+    NodeBase* tail_ = &head_;   // Последний узел (фиктивный, если список пуст)
+    size_t size_ = 0u;          // Размер списка
+    NodeAllocator node_alloc_;  // Аллокатор узлов
+
+    // Функция получения изменяемой статистики списка
+    SINGLE_LINKED_LIST_CONSTEXPR Stats& GetStatsRef() noexcept { return *this; }
+
+    // Функция создания узла через аллокатор
+    template <typename... Args>
+    SINGLE_LINKED_LIST_CONSTEXPR Node* CreateNode(Args&&... args) {
+        Node* node = NodeAllocTraits::allocate(node_alloc_, 1u);
+        try {
+            NodeAllocTraits::construct(node_alloc_, node, std::forward<Args>(args)...);
+        } catch (...) {
+            NodeAllocTraits::deallocate(node_alloc_, node, 1u);
+            throw;
+        }
+        GetStatsRef().OnNodeAllocated();
+        return node;
+    }
+
+    // Функция разрушения узла через аллокатор
+    SINGLE_LINKED_LIST_CONSTEXPR void DestroyNode(NodeBase* node_base) noexcept {
+        Node* node = static_cast<Node*>(node_base);
+        NodeAllocTraits::destroy(node_alloc_, node);
+        NodeAllocTraits::deallocate(node_alloc_, node, 1u);
+        GetStatsRef().OnNodesFreed(1u);
+    }
+
+    // Функция обмена с другим списком вместе с аллокаторами
+    SINGLE_LINKED_LIST_CONSTEXPR void SwapWithAllocator(SingleLinkedList& other) noexcept {
+        using std::swap;
+        SwapNodes(other);
+        swap(node_alloc_, other.node_alloc_);
+    }
+
+    // Функция обмена узлами с другим списком. Указатель на последний узел пустого списка
+    // указывает на его собственный фиктивный узел, поэтому после обмена он пересчитывается
+    SINGLE_LINKED_LIST_CONSTEXPR void SwapNodes(SingleLinkedList& other) noexcept {
+        std::swap(head_.next_node, other.head_.next_node);
+        std::swap(tail_, other.tail_);
+        std::swap(size_, other.size_);
+        if (!head_.next_node)       tail_ = &head_;
+        if (!other.head_.next_node) other.tail_ = &other.head_;
+        GetStatsRef().OnSize(size_);
+        other.GetStatsRef().OnSize(other.size_);
+    }
+
+    // Функция слияния двух отсортированных цепочек узлов (заканчивающихся nullptr) и подцепления
+    // результата после узла back. При равенстве элементов первым идёт элемент из left. Возвращает последний узел
+    // Если comp выбросит исключение, оставшиеся узлы обеих цепочек подцепляются после back
+    template <typename Compare>
+    SINGLE_LINKED_LIST_CONSTEXPR static NodeBase* MergeChains(NodeBase* back, NodeBase* left, NodeBase* right, Compare& comp) {
+        try {
+            while (left && right) {
+                if (comp(static_cast<Node*>(right)->value, static_cast<Node*>(left)->value)) {
+                    back->next_node = right;
+                    right = right->next_node;
+                } else {
+                    back->next_node = left;
+                    left = left->next_node;
+                }
+                back = back->next_node;
+            }
+        } catch (...) {
+            back->next_node = left ? left : right;
+            if (left) FindLast(left)->next_node = right;
+            throw;
+        }
+
+        back->next_node = left ? left : right;
+        return FindLast(back);
+    }
+
+    // Функция подцепления цепочки узлов [front; back] после узла pos
+    SINGLE_LINKED_LIST_CONSTEXPR void LinkChainAfter(NodeBase* pos, NodeBase* front, NodeBase* back) noexcept {
+        back->next_node = pos->next_node;
+        pos->next_node = front;
+        if (pos == tail_) tail_ = back;
+    }
+
+    // Функция перезаписи списка count элементами, начиная с first, с переиспользованием узлов. Недостающие
+    // узлы создаются заранее в отдельной цепочке (при исключении список не меняется), после чего значения
+    // существующих узлов перезаписываются без исключений, а лишние узлы освобождаются
+    template <typename ForwardIterator>
+    SINGLE_LINKED_LIST_CONSTEXPR void AssignRecycling(ForwardIterator first, size_t count) {
+        const size_t kept = std::min(size_, count);
+
+        SingleLinkedList tail(node_alloc_);
+        if constexpr (HasBulkReserve<NodeAllocator>::value) {
+            if (count > kept) {
+                tail.node_alloc_.Reserve(count - kept);
+            }
+        }
+        ForwardIterator rest = std::next(first, static_cast<typename std::iterator_traits<ForwardIterator>::difference_type>(kept));
+        for (size_t i = kept; i < count; ++i, ++rest) {
+            tail.AppendNode(*rest);
+        }
+        tail.GetStatsRef().OnSize(tail.size_);
+
+        NodeBase* node = &head_;
+        for (size_t i = 0u; i < kept; ++i, ++first) {
+            node = node->next_node;
+            static_cast<Node*>(node)->value = *first;
+        }
+        ReplaceAfter(node, tail);
+    }
+
+    // Функция замены всех узлов после last_kept узлами списка tail
+    SINGLE_LINKED_LIST_CONSTEXPR void ReplaceAfter(NodeBase* last_kept, SingleLinkedList& tail) noexcept {
+        EraseAfter(ConstIterator(last_kept), cend());
+        SpliceAfter(cbefore_end(), tail);
+        GetStatsRef().Merge(tail.GetStats());
+    }
+
+    // Функция изменения размера списка (см. Resize): новые элементы создаются из аргументов args
+    template <typename... Args>
+    SINGLE_LINKED_LIST_CONSTEXPR void ResizeWith(size_t count, const Args&... args) {
+        if (count <= size_) {
+            NodeBase* node = &head_;
+            for (size_t i = 0u; i < count; ++i) {
+                node = node->next_node;
+            }
+            EraseAfter(ConstIterator(node), cend());
+            return;
+        }
+
+        SingleLinkedList tail(node_alloc_);
+        for (size_t i = size_; i < count; ++i) {
+            tail.AppendNode(args...);
+        }
+        tail.GetStatsRef().OnSize(tail.size_);
+        ReplaceAfter(tail_, tail);
+    }
+
+    // Функция добавления узла в конец списка без обновления статистики размера (для заполнения нового списка)
+    template <typename... Args>
+    SINGLE_LINKED_LIST_CONSTEXPR void AppendNode(Args&&... args) {
+        tail_->next_node = CreateNode(nullptr, std::forward<Args>(args)...);
+        tail_ = tail_->next_node;
+        ++size_;
+    }
+
+    // Функция поиска последнего узла цепочки, начинающейся с node
+    SINGLE_LINKED_LIST_CONSTEXPR static NodeBase* FindLast(NodeBase* node) noexcept {
+        while (node->next_node) {
+            node = node->next_node;
+        }
+        return node;
+    }
 
     // Функция для реализации идеомы copy-and-swap в конструкторе: создаёт список, инициализированный
-    // элементами в интервале [begin; end) и меняет его местами с текущим
+    // элементами в интервале [begin; end) и меняет его местами с текущим.
+    // count - известное заранее количество элементов интервала (0, если неизвестно): аллокатор с пулом
+    // резервирует под копию блоки подряд, и узлы копии лежат в памяти в порядке списка
     template <typename ContainerIterator>
-    void CopyAndSwapFromIteratorRage(const ContainerIterator begin, const ContainerIterator end) {
-        SingleLinkedList<Type> tmp;
+    SINGLE_LINKED_LIST_CONSTEXPR void CopyAndSwapFromIteratorRage(const ContainerIterator begin, const ContainerIterator end, size_t count = 0u) {
+        SingleLinkedList tmp(node_alloc_);
 
-        Node* back = &tmp.head_;
+        if constexpr (HasBulkReserve<NodeAllocator>::value) {
+            if (count > 0u) {
+                tmp.node_alloc_.Reserve(count);
+            }
+        }
 
-        for (ContainerIterator it = begin; it != end; ++it) {
-            back->next_node = new Node(*it, nullptr);
-            back = back->next_node;
-            ++tmp.size_;
+        if constexpr (std::is_same_v<ContainerIterator, ConstIterator>) {
+            // Копирование другого списка: исходные узлы обходятся с упреждающей выборкой
+            for (PrefetchingCursor cursor(begin.node_); cursor.Get() != end.node_; cursor.Advance()) {
+                tmp.AppendNode(static_cast<const Node*>(cursor.Get())->value);
+            }
+        } else {
+            for (ContainerIterator it = begin; it != end; ++it) {
+                tmp.AppendNode(*it);
+            }
         }
+        tmp.GetStatsRef().OnSize(tmp.size_);
 
         this->swap(tmp);
+        tmp.Clear();
+        GetStatsRef().Merge(tmp.GetStats());
     }   
 };
 
 // Функция обмена формата swap(lhs, rhs)
-template <typename Type>
-void swap(SingleLinkedList<Type>& lhs, SingleLinkedList<Type>& rhs) noexcept {
+template <typename Type, typename Allocator, typename Stats>
+SINGLE_LINKED_LIST_CONSTEXPR void swap(SingleLinkedList<Type, Allocator, Stats>& lhs, SingleLinkedList<Type, Allocator, Stats>& rhs) noexcept {
     lhs.swap(rhs);
 }
 
 // Оператор сравнения списков "=="
-template <typename Type>
-bool operator == (const SingleLinkedList<Type>& lhs, const SingleLinkedList<Type>& rhs) {
-    return std::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend());
+template <typename Type, typename Allocator, typename Stats>
+SINGLE_LINKED_LIST_CONSTEXPR bool operator == (const SingleLinkedList<Type, Allocator, Stats>& lhs, const SingleLinkedList<Type, Allocator, Stats>& rhs) {
+    using List = SingleLinkedList<Type, Allocator, Stats>;
+    if (lhs.GetSize() != rhs.GetSize()) {
+        return false;
+    }
+
+    typename List::PrefetchingCursor left(lhs.head_.next_node), right(rhs.head_.next_node);
+    for (; left.Get(); left.Advance(), right.Advance()) {
+        if (!(static_cast<const typename List::Node*>(left.Get())->value == static_cast<const typename List::Node*>(right.Get())->value)) {
+            return false;
+        }
+    }
+    return true;
 }
 
 // Оператор сравнения списков "<"
-template <typename Type>
-bool operator < (const SingleLinkedList<Type>& lhs, const SingleLinkedList<Type>& rhs) {
-    return std::lexicographical_compare(lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend());
+template <typename Type, typename Allocator, typename Stats>
+SINGLE_LINKED_LIST_CONSTEXPR bool operator < (const SingleLinkedList<Type, Allocator, Stats>& lhs, const SingleLinkedList<Type, Allocator, Stats>& rhs) {
+    using List = SingleLinkedList<Type, Allocator, Stats>;
+    typename List::PrefetchingCursor left(lhs.head_.next_node), right(rhs.head_.next_node);
+    for (; left.Get() && right.Get(); left.Advance(), right.Advance()) {
+        const Type& left_value = static_cast<const typename List::Node*>(left.Get())->value;
+        const Type& right_value = static_cast<const typename List::Node*>(right.Get())->value;
+        if (left_value < right_value) return true;
+        if (right_value < left_value) return false;
+    }
+    return !left.Get() && right.Get();
 }
 
 // Производные от "==" и "<" операторы сравнения списков
-template <typename Type>
-bool operator != (const SingleLinkedList<Type>& lhs, const SingleLinkedList<Type>& rhs) { return !(lhs == rhs); }
+template <typename Type, typename Allocator, typename Stats>
+SINGLE_LINKED_LIST_CONSTEXPR bool operator != (const SingleLinkedList<Type, Allocator, Stats>& lhs, const SingleLinkedList<Type, Allocator, Stats>& rhs) { return !(lhs == rhs); }
 
-template <typename Type>
-bool operator >  (const SingleLinkedList<Type>& lhs, const SingleLinkedList<Type>& rhs) { return rhs < lhs; }
+template <typename Type, typename Allocator, typename Stats>
+SINGLE_LINKED_LIST_CONSTEXPR bool operator >  (const SingleLinkedList<Type, Allocator, Stats>& lhs, const SingleLinkedList<Type, Allocator, Stats>& rhs) { return rhs < lhs; }
 
-template <typename Type>
-bool operator <= (const SingleLinkedList<Type>& lhs, const SingleLinkedList<Type>& rhs) { return !(rhs < lhs); }
+template <typename Type, typename Allocator, typename Stats>
+SINGLE_LINKED_LIST_CONSTEXPR bool operator <= (const SingleLinkedList<Type, Allocator, Stats>& lhs, const SingleLinkedList<Type, Allocator, Stats>& rhs) { return !(rhs < lhs); }
 
-template <typename Type>
-bool operator >= (const SingleLinkedList<Type>& lhs, const SingleLinkedList<Type>& rhs) { return !(lhs < rhs); }
+template <typename Type, typename Allocator, typename Stats>
+SINGLE_LINKED_LIST_CONSTEXPR bool operator >= (const SingleLinkedList<Type, Allocator, Stats>& lhs, const SingleLinkedList<Type, Allocator, Stats>& rhs) { return !(lhs < rhs); }
 
 // Оператор "<<" для вывода содержимого списка в поток
-template <typename Type>
-std::ostream& operator << (std::ostream& os, const SingleLinkedList<Type>& single_linked_list) {
+template <typename Type, typename Allocator, typename Stats>
+std::ostream& operator << (std::ostream& os, const SingleLinkedList<Type, Allocator, Stats>& single_linked_list) {
     using namespace std::literals;
+    using List = SingleLinkedList<Type, Allocator, Stats>;
     os << "{"s;
     bool first = true;
-    for (const Type& element : single_linked_list) {
+    for (typename List::PrefetchingCursor cursor(single_linked_list.head_.next_node); cursor.Get(); cursor.Advance()) {
         if (!first) os << ", "s;
         else        first = false;
-        os << element;
+        os << static_cast<const typename List::Node*>(cursor.Get())->value;
     }
     os << "}"s;
     return os;
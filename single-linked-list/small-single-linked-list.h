@@ -0,0 +1,533 @@
+#pragma once
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// Класс односвязного списка с встроенным хранилищем на N узлов: первые N узлов размещаются прямо
+// в объекте списка, рядом с фиктивным узлом, и только следующие выделяются аллокатором. Короткие
+// списки (до N элементов) не обращаются к куче вовсе. Узлы, освобождённые во встроенном хранилище,
+// переиспользуются раньше, чем выделяются новые узлы в куче.
+// Итераторы и InsertAfter/EraseAfter/before_begin ведут себя как в SingleLinkedList. Отличие -
+// в перемещении и обмене: узлы в куче переходят к другому списку перецеплением указателей, а элементы
+// узлов встроенного хранилища (не больше N) перемещаются в то же место встроенного хранилища другого
+// списка. Поэтому перемещение и обмен работают за O(N) независимо от числа узлов в куче.
+// Итераторы после перемещения и обмена:
+//  - на элементы в куче остаются действительными и указывают на те же элементы уже в другом списке;
+//  - на элементы во встроенном хранилище и before_begin()/before_end() становятся недействительными;
+//  - end() остаётся действительным.
+// Перемещение и обмен не выбрасывают исключений, если их не выбрасывает конструктор перемещения Type.
+// Иначе элементы встроенного хранилища копируются (std::move_if_noexcept), и при исключении исходный
+// список не меняется. Перемещающее присваивание при неравных аллокаторах, которые не переходят при
+// присваивании, переносит элементы поэлементно за O(n)
+template <typename Type, size_t N, typename Allocator = std::allocator<Type>>
+class SmallSingleLinkedList {
+    static_assert(N > 0u, "Inline capacity must be positive");
+
+private:
+    // Базовая структура узла списка: только связь со следующим узлом (из неё состоит фиктивный узел)
+    struct NodeBase {
+        NodeBase* next_node = nullptr;
+    };
+
+    // Структура узла списка. Значение конструируется прямо в узле из переданных аргументов
+    struct Node : NodeBase {
+        template <typename... Args>
+        explicit Node(NodeBase* next, Args&&... args) : NodeBase{ next }, value(std::forward<Args>(args)...) { }
+
+        Type value;
+    };
+
+    // Аллокатор узлов в куче и его свойства
+    using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using NodeAllocTraits = std::allocator_traits<NodeAllocator>;
+
+    // Место под узел во встроенном хранилище
+    struct alignas(Node) InlineSlot {
+        std::byte storage[sizeof(Node)];
+    };
+
+    // Класс итератора/константного итератора (ValueType=Type/const Type) списка
+    template <typename ValueType>
+    class BasicIterator {
+        // Предоставим классу списка доступ к приватным полям и методам
+        friend class SmallSingleLinkedList;
+
+    public:
+        // Описание типа итератора
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = ValueType*;
+        using reference = ValueType&;
+
+        // Конструктор по умолчанию
+        BasicIterator() = default;
+
+        // Конструктор копирования
+        BasicIterator(const BasicIterator<Type>& other) noexcept : node_(other.node_) { }
+
+        // Оператор присваивания
+        BasicIterator& operator = (const BasicIterator& rhs) = default;
+
+        // Операторы сравнения неконстантных итераторов (ValueType = Type)
+        [[nodiscard]] bool operator == (const BasicIterator<Type>& rhs) const noexcept { return node_ == rhs.node_; }
+        [[nodiscard]] bool operator != (const BasicIterator<Type>& rhs) const noexcept { return !(*this == rhs); }
+
+        // Операторы сравнения константных итераторов (ValueType = const Type)
+        [[nodiscard]] bool operator == (const BasicIterator<const Type>& rhs) const noexcept { return node_ == rhs.node_; }
+        [[nodiscard]] bool operator != (const BasicIterator<const Type>& rhs) const noexcept { return !(*this == rhs); }
+
+        // Преинкремент
+        BasicIterator& operator ++ () noexcept {
+            assert(node_);
+            node_ = node_->next_node;
+            return *this;
+        }
+
+        // Постинкремент
+        BasicIterator operator ++ (int) noexcept {
+            BasicIterator tmp(*this);
+            ++(*this);
+            return tmp;
+        }
+
+        // Оператор разыменовывания
+        [[nodiscard]] reference operator * () const noexcept {
+            assert(node_);
+            return static_cast<Node*>(node_)->value;
+        }
+
+        // Оператор доступа к членам
+        [[nodiscard]] pointer operator -> () const noexcept {
+            assert(node_);
+            return &(static_cast<Node*>(node_)->value);
+        }
+
+    private:
+        // Указатель на узел
+        NodeBase* node_ = nullptr;
+
+        // Конструктор, создающий итератор из указателя на узел (используется в классе списка)
+        explicit BasicIterator(NodeBase* node) noexcept : node_(node) { }
+    };
+
+public:
+    // Псевдонимы для типов, ссылок, константных ссылок, итераторов и константных итераторов
+    using value_type = Type;
+    using allocator_type = Allocator;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+    using Iterator      = BasicIterator<Type>;
+    using ConstIterator = BasicIterator<const Type>;
+
+    // Количество узлов во встроенном хранилище
+    static constexpr size_t kInlineCapacity = N;
+
+    // Конструктор по умолчанию создаёт пустой список
+    SmallSingleLinkedList() noexcept(std::is_nothrow_default_constructible_v<NodeAllocator>) = default;
+
+    // Конструктор, создающий пустой список с заданным аллокатором
+    explicit SmallSingleLinkedList(const Allocator& alloc) noexcept : node_alloc_(alloc) { }
+
+    // Конструктор, создающий список из элементов std::initializer_list
+    SmallSingleLinkedList(std::initializer_list<Type> values, const Allocator& alloc = Allocator()) : node_alloc_(alloc) {
+        AppendRange(values.begin(), values.end());
+    }
+
+    // Конструктор копирования
+    SmallSingleLinkedList(const SmallSingleLinkedList& other)
+        : node_alloc_(NodeAllocTraits::select_on_container_copy_construction(other.node_alloc_)) {
+        AppendRange(other.begin(), other.end());
+    }
+
+    // Конструктор перемещения за O(N): узлы в куче перецепляются, other становится пустым
+    SmallSingleLinkedList(SmallSingleLinkedList&& other) noexcept(kNothrowSteal) : node_alloc_(other.node_alloc_) {
+        StealFrom(other);
+    }
+
+    // Деструктор
+    ~SmallSingleLinkedList() noexcept { Clear(); }
+
+    // Оператор присваивания
+    SmallSingleLinkedList& operator = (const SmallSingleLinkedList& rhs) {
+        if (this != &rhs) {
+            SmallSingleLinkedList rhs_copy(rhs);
+            *this = std::move(rhs_copy);
+        }
+        return *this;
+    }
+
+    // Оператор перемещающего присваивания за O(N), если аллокатор переходит при присваивании или
+    // аллокаторы равны, иначе поэлементно. При исключении в конструкторе элемента список останется пустым
+    SmallSingleLinkedList& operator = (SmallSingleLinkedList&& rhs)
+        noexcept(kNothrowSteal && (NodeAllocTraits::propagate_on_container_move_assignment::value
+                                   || NodeAllocTraits::is_always_equal::value)) {
+        if (this != &rhs) {
+            Clear();
+            if constexpr (NodeAllocTraits::propagate_on_container_move_assignment::value) {
+                node_alloc_ = rhs.node_alloc_;
+            }
+            if (NodeAllocTraits::propagate_on_container_move_assignment::value || node_alloc_ == rhs.node_alloc_) {
+                StealFrom(rhs);
+            } else {
+                AppendRange(std::make_move_iterator(rhs.begin()), std::make_move_iterator(rhs.end()));
+                rhs.Clear();
+            }
+        }
+        return *this;
+    }
+
+    // Итераторы, указывающие на начало, конец и фиктивный узел списка
+    [[nodiscard]] Iterator begin()        noexcept { return Iterator(head_.next_node); }
+    [[nodiscard]] Iterator end()          noexcept { return Iterator(nullptr); }
+    [[nodiscard]] Iterator before_begin() noexcept { return Iterator(&head_); }
+
+    // Итератор, указывающий на последний элемент списка (на фиктивный узел, если список пуст)
+    [[nodiscard]] Iterator      before_end()        noexcept { return Iterator(tail_); }
+    [[nodiscard]] ConstIterator before_end()  const noexcept { return cbefore_end(); }
+    [[nodiscard]] ConstIterator cbefore_end() const noexcept { return Iterator(tail_); }
+
+    // Константные итераторы, указывающие на начало, конец и фиктивный узел списка
+    [[nodiscard]] ConstIterator begin()        const noexcept { return cbegin(); }
+    [[nodiscard]] ConstIterator end()          const noexcept { return cend(); }
+    [[nodiscard]] ConstIterator before_begin() const noexcept { return cbefore_begin(); }
+
+    [[nodiscard]] ConstIterator cbegin()        const noexcept { return Iterator(head_.next_node); }
+    [[nodiscard]] ConstIterator cend()          const noexcept { return Iterator(nullptr); }
+    [[nodiscard]] ConstIterator cbefore_begin() const noexcept { return Iterator(const_cast<NodeBase*>(&head_)); }
+
+    // Функция обмена с другим списком за O(N). Аллокаторы обмениваются, если они переходят при обмене,
+    // иначе должны быть равны. Если конструктор перемещения Type может выбросить исключение, при
+    // исключении оба списка остаются корректными, но элементы other могут быть потеряны
+    void swap(SmallSingleLinkedList& other) noexcept(kNothrowSteal) {
+        if (this == &other) {
+            return;
+        }
+        assert(NodeAllocTraits::propagate_on_container_swap::value || node_alloc_ == other.node_alloc_);
+
+        SmallSingleLinkedList tmp(std::move(other));
+        if constexpr (NodeAllocTraits::propagate_on_container_swap::value) {
+            using std::swap;
+            swap(node_alloc_, other.node_alloc_);
+        }
+        other.StealFrom(*this);
+        StealFrom(tmp);
+    }
+
+    // Функция получения копии аллокатора
+    [[nodiscard]] allocator_type get_allocator() const noexcept { return allocator_type(node_alloc_); }
+
+    // Функция получения размера
+    [[nodiscard]] size_t GetSize() const noexcept { return size_; }
+
+    // Функция проверки на пустоту
+    [[nodiscard]] bool IsEmpty() const noexcept { return size_ == 0u; }
+
+    // Функция получения количества узлов, выделенных в куче
+    [[nodiscard]] size_t GetHeapNodeCount() const noexcept { return heap_nodes_; }
+
+    // Функции доступа к первому и последнему элементам списка
+    [[nodiscard]] reference       front()       noexcept { assert(!IsEmpty()); return *begin(); }
+    [[nodiscard]] const_reference front() const noexcept { assert(!IsEmpty()); return *cbegin(); }
+    [[nodiscard]] reference       back()        noexcept { assert(!IsEmpty()); return static_cast<Node*>(tail_)->value; }
+    [[nodiscard]] const_reference back()  const noexcept { assert(!IsEmpty()); return static_cast<const Node*>(tail_)->value; }
+
+    // Функция добавления в начало списка
+    void PushFront(const Type& value) { EmplaceAfter(cbefore_begin(), value); }
+    void PushFront(Type&& value) { EmplaceAfter(cbefore_begin(), std::move(value)); }
+
+    // Функция создания элемента в начале списка из аргументов конструктора Type
+    template <typename... Args>
+    reference EmplaceFront(Args&&... args) { return *EmplaceAfter(cbefore_begin(), std::forward<Args>(args)...); }
+
+    // Функция удаления из начала списка
+    void PopFront() noexcept {
+        assert(!IsEmpty());
+        EraseAfter(cbefore_begin());
+    }
+
+    // Функция добавления в конец списка за O(1)
+    void PushBack(const Type& value) { EmplaceAfter(cbefore_end(), value); }
+    void PushBack(Type&& value) { EmplaceAfter(cbefore_end(), std::move(value)); }
+
+    // Функция создания элемента в конце списка из аргументов конструктора Type
+    template <typename... Args>
+    reference EmplaceBack(Args&&... args) { return *EmplaceAfter(cbefore_end(), std::forward<Args>(args)...); }
+
+    // Функция удаления из конца списка за O(n)
+    void PopBack() noexcept {
+        assert(!IsEmpty());
+
+        NodeBase* pre_back = &head_;
+        while (pre_back->next_node != tail_) { pre_back = pre_back->next_node; }
+        EraseAfter(ConstIterator(pre_back));
+    }
+
+    // Функция добавления после элемента, на который указывает итератор
+    Iterator InsertAfter(ConstIterator pos, const Type& value) { return EmplaceAfter(pos, value); }
+    Iterator InsertAfter(ConstIterator pos, Type&& value) { return EmplaceAfter(pos, std::move(value)); }
+
+    // Функция создания элемента после элемента, на который указывает итератор, из аргументов конструктора Type
+    template <typename... Args>
+    Iterator EmplaceAfter(ConstIterator pos, Args&&... args) {
+        assert(pos.node_);
+
+        NodeBase* node = CreateNode(pos.node_->next_node, std::forward<Args>(args)...);
+        if (IsInline(node)) inline_prev_[SlotOf(node)] = pos.node_;
+        if (IsInline(node->next_node)) inline_prev_[SlotOf(node->next_node)] = node;
+        pos.node_->next_node = node;
+        if (pos.node_ == tail_) tail_ = node;
+        ++size_;
+        return Iterator(pos.node_->next_node);
+    }
+
+    // Функция удаления после элемента, на который указывает итератор
+    Iterator EraseAfter(ConstIterator pos) noexcept {
+        assert(pos.node_);
+        assert(pos.node_->next_node);
+
+        NodeBase* tmp = pos.node_->next_node->next_node;
+        if (pos.node_->next_node == tail_) tail_ = pos.node_;
+        DestroyNode(pos.node_->next_node);
+        pos.node_->next_node = tmp;
+        if (IsInline(tmp)) inline_prev_[SlotOf(tmp)] = pos.node_;
+        --size_;
+
+        return Iterator(tmp);
+    }
+
+    // Очистка списка
+    void Clear() noexcept {
+        while (head_.next_node) {
+            NodeBase* tmp = head_.next_node->next_node;
+            DestroyNode(head_.next_node);
+            head_.next_node = tmp;
+        }
+
+        tail_ = &head_;
+        size_ = 0u;
+        inline_used_ = 0u;
+        inline_free_ = nullptr;
+    }
+
+private:
+    NodeBase head_;                   // Фиктивный узел
+    NodeBase* tail_ = &head_;         // Последний узел (фиктивный, если список пуст)
+    size_t size_ = 0u;                // Размер списка
+    size_t heap_nodes_ = 0u;          // Узлов в куче
+    size_t inline_used_ = 0u;         // Мест встроенного хранилища, хоть раз занятых узлами
+    NodeBase* inline_free_ = nullptr; // Освобождённые места встроенного хранилища (связаны через next_node)
+    InlineSlot inline_[N];            // Встроенное хранилище узлов
+    NodeBase* inline_prev_[N] = {};   // Предыдущие узлы узлов встроенного хранилища (nullptr - место свободно)
+    NodeAllocator node_alloc_;        // Аллокатор узлов в куче
+
+    // Перемещение и обмен не выбрасывают исключений, если их не выбрасывает конструктор перемещения Type
+    static constexpr bool kNothrowSteal = std::is_nothrow_move_constructible_v<Type>;
+
+    // Функция проверки того, что узел лежит во встроенном хранилище
+    bool IsInline(const NodeBase* node) const noexcept {
+        const auto address = reinterpret_cast<std::uintptr_t>(node);
+        return address >= reinterpret_cast<std::uintptr_t>(inline_)
+            && address < reinterpret_cast<std::uintptr_t>(inline_ + N);
+    }
+
+    // Номер места встроенного хранилища, в котором лежит узел
+    size_t SlotOf(const NodeBase* node) const noexcept {
+        assert(IsInline(node));
+        return (reinterpret_cast<std::uintptr_t>(node) - reinterpret_cast<std::uintptr_t>(inline_)) / sizeof(InlineSlot);
+    }
+
+    // Узел в месте slot встроенного хранилища (занятом или свободном)
+    NodeBase* InlineBase(size_t slot) noexcept { return std::launder(reinterpret_cast<NodeBase*>(inline_[slot].storage)); }
+    Node* InlineNode(size_t slot) noexcept { return std::launder(reinterpret_cast<Node*>(inline_[slot].storage)); }
+
+    // Указатель этого списка, соответствующий указателю node списка source: фиктивный узел и места
+    // встроенного хранилища source переходят в те же места этого списка, узлы в куче - как есть
+    NodeBase* Adopted(NodeBase* node, SmallSingleLinkedList& source) noexcept {
+        if (node == &source.head_) return &head_;
+        if (source.IsInline(node)) return InlineBase(source.SlotOf(node));
+        return node;
+    }
+
+    // Перенос всех узлов source в этот (пустой) список за O(N): элементы встроенного хранилища source
+    // создаются в тех же местах этого списка, узлы в куче перецепляются. source становится пустым.
+    // Аллокатор этого списка должен уметь освобождать узлы source. При исключении в конструкторе
+    // элемента оба списка не меняются
+    void StealFrom(SmallSingleLinkedList& source) noexcept(kNothrowSteal) {
+        assert(IsEmpty() && inline_used_ == 0u);
+
+        // Сначала создаются элементы: до конца этого цикла ни один из списков не изменён
+        size_t slot = 0u;
+        const auto construct_elements = [&] {
+            for (; slot < source.inline_used_; ++slot) {
+                if (source.inline_prev_[slot]) {
+                    ::new (static_cast<void*>(inline_[slot].storage))
+                        Node(nullptr, std::move_if_noexcept(source.InlineNode(slot)->value));
+                }
+            }
+        };
+        if constexpr (kNothrowSteal) {
+            construct_elements();
+        } else {
+            try {
+                construct_elements();
+            } catch (...) {
+                while (slot-- > 0u) {
+                    if (source.inline_prev_[slot]) InlineNode(slot)->~Node();
+                }
+                throw;
+            }
+        }
+
+        // Затем перецепляются связи и разрушаются элементы source
+        for (slot = 0u; slot < source.inline_used_; ++slot) {
+            NodeBase* source_node = source.InlineBase(slot);
+            NodeBase* next = Adopted(source_node->next_node, source);
+            if (NodeBase* prev = source.inline_prev_[slot]) {
+                InlineBase(slot)->next_node = next;
+                inline_prev_[slot] = Adopted(prev, source);
+                if (prev != &source.head_ && !source.IsInline(prev)) {
+                    prev->next_node = InlineBase(slot);
+                }
+                source.InlineNode(slot)->~Node();
+                source.inline_prev_[slot] = nullptr;
+            } else {
+                ::new (static_cast<void*>(inline_[slot].storage)) NodeBase{ next };
+            }
+        }
+
+        head_.next_node = Adopted(source.head_.next_node, source);
+        tail_ = Adopted(source.tail_, source);
+        size_ = source.size_;
+        heap_nodes_ = source.heap_nodes_;
+        inline_used_ = source.inline_used_;
+        inline_free_ = Adopted(source.inline_free_, source);
+
+        source.head_.next_node = nullptr;
+        source.tail_ = &source.head_;
+        source.size_ = 0u;
+        source.heap_nodes_ = 0u;
+        source.inline_used_ = 0u;
+        source.inline_free_ = nullptr;
+    }
+
+    // Функция создания узла: во встроенном хранилище, если там есть место, иначе через аллокатор
+    template <typename... Args>
+    Node* CreateNode(NodeBase* next, Args&&... args) {
+        void* place = nullptr;
+        if (inline_free_) {
+            place = inline_free_;
+        } else if (inline_used_ < N) {
+            place = inline_[inline_used_].storage;
+        }
+
+        if (place) {
+            NodeBase* free_next = inline_free_ ? inline_free_->next_node : nullptr;
+            Node* node = nullptr;
+            try {
+                node = ::new (place) Node(next, std::forward<Args>(args)...);
+            } catch (...) {
+                // NodeBase узла уже затёр ссылку свободного места: восстанавливаем её, иначе список
+                // свободных мест указал бы на живой узел списка
+                if (inline_free_) {
+                    ::new (place) NodeBase{ free_next };
+                }
+                throw;
+            }
+            if (inline_free_) {
+                inline_free_ = free_next;
+            } else {
+                ++inline_used_;
+            }
+            return node;
+        }
+
+        Node* node = NodeAllocTraits::allocate(node_alloc_, 1u);
+        try {
+            NodeAllocTraits::construct(node_alloc_, node, next, std::forward<Args>(args)...);
+        } catch (...) {
+            NodeAllocTraits::deallocate(node_alloc_, node, 1u);
+            throw;
+        }
+        ++heap_nodes_;
+        return node;
+    }
+
+    // Функция разрушения узла: место во встроенном хранилище возвращается в список свободных мест
+    void DestroyNode(NodeBase* node_base) noexcept {
+        Node* node = static_cast<Node*>(node_base);
+        if (IsInline(node)) {
+            inline_prev_[SlotOf(node)] = nullptr;
+            node->~Node();
+            NodeBase* free_slot = ::new (static_cast<void*>(node)) NodeBase{ inline_free_ };
+            inline_free_ = free_slot;
+            return;
+        }
+        NodeAllocTraits::destroy(node_alloc_, node);
+        NodeAllocTraits::deallocate(node_alloc_, node, 1u);
+        --heap_nodes_;
+    }
+
+    // Функция добавления элементов интервала [first; last) в конец списка
+    template <typename InputIterator>
+    void AppendRange(InputIterator first, InputIterator last) {
+        for (; first != last; ++first) {
+            EmplaceAfter(cbefore_end(), *first);
+        }
+    }
+};
+
+// Функция обмена формата swap(lhs, rhs)
+template <typename Type, size_t N, typename Allocator>
+void swap(SmallSingleLinkedList<Type, N, Allocator>& lhs, SmallSingleLinkedList<Type, N, Allocator>& rhs) noexcept(noexcept(lhs.swap(rhs))) {
+    lhs.swap(rhs);
+}
+
+// Оператор сравнения списков "=="
+template <typename Type, size_t N, typename Allocator>
+bool operator == (const SmallSingleLinkedList<Type, N, Allocator>& lhs, const SmallSingleLinkedList<Type, N, Allocator>& rhs) {
+    return lhs.GetSize() == rhs.GetSize() && std::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin());
+}
+
+// Оператор сравнения списков "<"
+template <typename Type, size_t N, typename Allocator>
+bool operator < (const SmallSingleLinkedList<Type, N, Allocator>& lhs, const SmallSingleLinkedList<Type, N, Allocator>& rhs) {
+    return std::lexicographical_compare(lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend());
+}
+
+// Производные от "==" и "<" операторы сравнения списков
+template <typename Type, size_t N, typename Allocator>
+bool operator != (const SmallSingleLinkedList<Type, N, Allocator>& lhs, const SmallSingleLinkedList<Type, N, Allocator>& rhs) { return !(lhs == rhs); }
+
+template <typename Type, size_t N, typename Allocator>
+bool operator >  (const SmallSingleLinkedList<Type, N, Allocator>& lhs, const SmallSingleLinkedList<Type, N, Allocator>& rhs) { return rhs < lhs; }
+
+template <typename Type, size_t N, typename Allocator>
+bool operator <= (const SmallSingleLinkedList<Type, N, Allocator>& lhs, const SmallSingleLinkedList<Type, N, Allocator>& rhs) { return !(rhs < lhs); }
+
+template <typename Type, size_t N, typename Allocator>
+bool operator >= (const SmallSingleLinkedList<Type, N, Allocator>& lhs, const SmallSingleLinkedList<Type, N, Allocator>& rhs) { return !(lhs < rhs); }
+
+// Оператор "<<" для вывода содержимого списка в поток
+template <typename Type, size_t N, typename Allocator>
+std::ostream& operator << (std::ostream& os, const SmallSingleLinkedList<Type, N, Allocator>& small_list) {
+    using namespace std::literals;
+    os << "{"s;
+    bool first = true;
+    for (const Type& element : small_list) {
+        if (!first) os << ", "s;
+        else        first = false;
+        os << element;
+    }
+    os << "}"s;
+    return os;
+}
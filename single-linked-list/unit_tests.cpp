@@ -1,7 +1,42 @@
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <numeric>
+#include <random>
+#include <sstream>
 #include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 #include "unit_tests.h"
 #include "unit_tests_framework.h"
 #include "single-linked-list.h"
+#include "node-pool-allocator.h"
+#include "unrolled-single-linked-list.h"
+#include "compact-single-linked-list.h"
+#include "indexed-single-linked-list.h"
+#include "small-single-linked-list.h"
+#include "persistent-single-linked-list.h"
+#include "intrusive-single-linked-list.h"
+#include "concurrent-single-linked-list.h"
+#include "mpsc-queue.h"
+#include "single-linked-list-parallel.h"
+#include "single-linked-list-serialization.h"
+#include "single-linked-list-views.h"
+#include "mapped-single-linked-list.h"
+#include "single-linked-list-hash-map.h"
+
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
 using namespace std;
 
 // Пространство имён для Unit-тестов
@@ -42,6 +77,34 @@ struct ThrowOnCopy {
     int* countdown_ptr = nullptr;
 };
 
+// Структура подопытного объекта без конструктора по умолчанию, считающая свои копирования и перемещения
+struct CopyMoveCounter {
+    CopyMoveCounter(int& copies, int& moves) noexcept : copies_ptr(&copies), moves_ptr(&moves) { }
+
+    CopyMoveCounter(const CopyMoveCounter& other) noexcept : copies_ptr(other.copies_ptr), moves_ptr(other.moves_ptr) {
+        ++(*copies_ptr);
+    }
+
+    CopyMoveCounter(CopyMoveCounter&& other) noexcept : copies_ptr(other.copies_ptr), moves_ptr(other.moves_ptr) {
+        ++(*moves_ptr);
+    }
+
+    CopyMoveCounter& operator=(const CopyMoveCounter& rhs) = delete;
+
+    int* copies_ptr = nullptr;
+    int* moves_ptr = nullptr;
+};
+
+// Функция построения списка из чисел 0, 1, ..., n - 1 (подготовка состояния для проверок асимптотики)
+template <typename List>
+List MakeIotaList(size_t n) {
+    List list;
+    for (size_t i = 0u; i < n; ++i) {
+        list.PushBack(static_cast<int>(i));
+    }
+    return list;
+}
+
 // UNIT-TEST: Проверка PopFront
 void UnitTestPopFront() {
     SingleLinkedList<int> numbers{ 3, 14, 15, 92, 6 };
@@ -55,6 +118,16 @@ void UnitTestPopFront() {
     ASSERT_EQUAL(deletion_counter, 0);
     list.PopFront();
     ASSERT_EQUAL(deletion_counter, 1);
+
+    // Добавление и удаление в начале списка не зависят от его размера
+    const auto push_front = [](SingleLinkedList<int>& lst) {
+        for (int i = 0; i < 64; ++i) lst.PushFront(i);
+    };
+    const auto pop_front = [](SingleLinkedList<int>& lst) {
+        for (int i = 0; i < 64; ++i) lst.PopFront();
+    };
+    ASSERT_COMPLEXITY(Complexity::Constant, 1u << 16, MakeIotaList<SingleLinkedList<int>>, push_front);
+    ASSERT_COMPLEXITY(Complexity::Constant, 1u << 16, MakeIotaList<SingleLinkedList<int>>, pop_front);
 }
 
 // UNIT-TEST: Проверка доступа к позиции, предшествующей begin
@@ -98,6 +171,12 @@ void UnitTestInsertAfter() {
         ASSERT_EQUAL(*inserted_item_pos, 555);
         ASSERT((lst == SingleLinkedList<int>{123, 555, 1, 2, 3}));
     };
+
+    // Вставка после элемента не зависит от размера списка
+    const auto insert_after = [](SingleLinkedList<int>& lst) {
+        for (int i = 0; i < 64; ++i) lst.InsertAfter(lst.begin(), i);
+    };
+    ASSERT_COMPLEXITY(Complexity::Constant, 1u << 16, MakeIotaList<SingleLinkedList<int>>, insert_after);
 }
 
 // UNIT-TEST: Проверка обеспечения строгой гарантии безопасности исключений
@@ -152,15 +231,2398 @@ void UnitTestEraseAfter() {
         list.EraseAfter(list.cbegin());
         ASSERT_EQUAL(deletion_counter, 1u);
     }
+
+    // Удаление после элемента не зависит от размера списка
+    const auto erase_after = [](SingleLinkedList<int>& lst) {
+        for (int i = 0; i < 64; ++i) lst.EraseAfter(lst.begin());
+    };
+    ASSERT_COMPLEXITY(Complexity::Constant, 1u << 16, MakeIotaList<SingleLinkedList<int>>, erase_after);
 }
 
-// Запуск Unit-тестов для односвязного списка
-void RunTestSingleLinkedList() {
-    RUN_TEST(UnitTestPopFront);
-    RUN_TEST(UnitTestBeforeBegin);
-    RUN_TEST(UnitTestInsertAfter);
-    RUN_TEST(UnitTestNoExcept);
-    RUN_TEST(UnitTestEraseAfter);
+// UNIT-TEST: Проверка перемещения списков и создания элементов на месте
+void UnitTestMoveAndEmplace() {
+    // Конструктор перемещения и перемещающее присваивание забирают узлы
+    {
+        SingleLinkedList<int> lst{ 1, 2, 3 };
+        const int* first = &*lst.begin();
+
+        SingleLinkedList<int> moved(std::move(lst));
+        ASSERT((moved == SingleLinkedList<int>{ 1, 2, 3 }));
+        ASSERT_EQUAL(&*moved.begin(), first);
+        ASSERT(lst.IsEmpty());
+
+        SingleLinkedList<int> assigned{ 4 };
+        assigned = std::move(moved);
+        ASSERT((assigned == SingleLinkedList<int>{ 1, 2, 3 }));
+        ASSERT_EQUAL(&*assigned.begin(), first);
+        ASSERT(moved.IsEmpty());
+    }
+
+    // Перемещающие перегрузки и Emplace* не копируют элементы
+    {
+        int copies = 0;
+        int moves = 0;
+        SingleLinkedList<CopyMoveCounter> lst;
+        lst.EmplaceFront(copies, moves);
+        lst.EmplaceBack(copies, moves);
+        lst.EmplaceAfter(lst.cbegin(), copies, moves);
+        ASSERT_EQUAL(lst.GetSize(), 3u);
+        ASSERT_EQUAL(copies, 0);
+        ASSERT_EQUAL(moves, 0);
+
+        lst.PushFront(CopyMoveCounter(copies, moves));
+        lst.PushBack(CopyMoveCounter(copies, moves));
+        lst.InsertAfter(lst.cbegin(), CopyMoveCounter(copies, moves));
+        ASSERT_EQUAL(lst.GetSize(), 6u);
+        ASSERT_EQUAL(copies, 0);
+        ASSERT_EQUAL(moves, 3);
+    }
+
+    // Emplace* возвращают созданный элемент
+    {
+        SingleLinkedList<std::string> lst;
+        ASSERT_EQUAL(lst.EmplaceFront(3u, 'a'), "aaa"s);
+        ASSERT_EQUAL(lst.EmplaceBack("b"s), "b"s);
+        ASSERT_EQUAL(*lst.EmplaceAfter(lst.cbefore_begin(), "c"), "c"s);
+        ASSERT((lst == SingleLinkedList<std::string>{ "c"s, "aaa"s, "b"s }));
+    }
+
+    // При исключении в конструкторе элемента список не меняется
+    {
+        int copy_counter = 0;
+        SingleLinkedList<ThrowOnCopy> lst;
+        lst.EmplaceFront();
+        try {
+            const ThrowOnCopy throwing(copy_counter);
+            lst.EmplaceFront(throwing);
+            ASSERT_HINT(false, "exception expected"s);
+        }
+        catch (const std::bad_alloc&) {
+            ASSERT_EQUAL(lst.GetSize(), 1u);
+        }
+    }
+}
+
+// UNIT-TEST: Проверка поддержки последнего элемента (PushBack, PopBack, back, before_end)
+void UnitTestBackAccess() {
+    {
+        SingleLinkedList<int> lst;
+        ASSERT(lst.before_end() == lst.before_begin());
+        lst.PushBack(1);
+        lst.PushBack(2);
+        ASSERT_EQUAL(lst.back(), 2);
+        ASSERT_EQUAL(*lst.before_end(), 2);
+
+        // Вставка после последнего элемента и удаление последнего элемента сдвигают конец списка
+        lst.InsertAfter(lst.before_end(), 3);
+        ASSERT_EQUAL(lst.back(), 3);
+        lst.EraseAfter(lst.begin());
+        lst.EraseAfter(lst.begin());
+        ASSERT_EQUAL(lst.back(), 1);
+        lst.PushBack(4);
+        ASSERT((lst == SingleLinkedList<int>{ 1, 4 }));
+
+        lst.PopBack();
+        ASSERT_EQUAL(lst.back(), 1);
+        lst.PopFront();
+        ASSERT(lst.before_end() == lst.before_begin());
+        lst.PushFront(5);
+        lst.PushBack(6);
+        ASSERT((lst == SingleLinkedList<int>{ 5, 6 }));
+    }
+
+    // Обмен, копирование, перемещение и очистка сохраняют корректный последний элемент
+    {
+        SingleLinkedList<int> lst{ 1, 2 };
+        SingleLinkedList<int> empty;
+        lst.swap(empty);
+        ASSERT(lst.before_end() == lst.before_begin());
+        ASSERT_EQUAL(empty.back(), 2);
+        lst.PushBack(3);
+        empty.PushBack(4);
+        ASSERT((lst == SingleLinkedList<int>{ 3 }));
+        ASSERT((empty == SingleLinkedList<int>{ 1, 2, 4 }));
+
+        SingleLinkedList<int> copy(empty);
+        copy.PushBack(5);
+        ASSERT_EQUAL(copy.back(), 5);
+        ASSERT_EQUAL(empty.back(), 4);
+
+        SingleLinkedList<int> moved(std::move(copy));
+        copy.PushBack(6);
+        moved.PushBack(7);
+        ASSERT((copy == SingleLinkedList<int>{ 6 }));
+        ASSERT((moved == SingleLinkedList<int>{ 1, 2, 4, 5, 7 }));
+
+        moved.Clear();
+        moved.PushBack(8);
+        ASSERT_EQUAL(moved.back(), 8);
+        ASSERT_EQUAL(moved.GetSize(), 1u);
+    }
+
+    // PushBack и back используют последний узел за O(1), PopBack ищет предпоследний узел за O(n)
+    {
+        const auto push_back = [](SingleLinkedList<int>& lst) {
+            for (int i = 0; i < 64; ++i) lst.PushBack(lst.back() + i);
+        };
+        const auto pop_back = [](SingleLinkedList<int>& lst) {
+            lst.PopBack();
+        };
+        ASSERT_COMPLEXITY(Complexity::Constant, 1u << 16, MakeIotaList<SingleLinkedList<int>>, push_back);
+        ASSERT_COMPLEXITY(Complexity::Linear, 1u << 16, MakeIotaList<SingleLinkedList<int>>, pop_back);
+    }
+}
+
+// UNIT-TEST: Проверка сортировки и слияния списков
+void UnitTestSortAndMerge() {
+    // Сортировка совпадает с std::stable_sort и не перемещает элементы между узлами
+    {
+        std::mt19937 generator(7);
+        std::vector<std::pair<int, int>> expected;
+        SingleLinkedList<std::pair<int, int>> lst;
+        for (int i = 0; i < 1000; ++i) {
+            const std::pair<int, int> item{ static_cast<int>(generator() % 50u), i };
+            expected.push_back(item);
+            lst.PushBack(item);
+        }
+        const auto by_first = [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; };
+        std::stable_sort(expected.begin(), expected.end(), by_first);
+
+        const std::pair<int, int>* address_of_first_pushed = &*lst.begin();
+        lst.Sort(by_first);
+        ASSERT(std::equal(lst.begin(), lst.end(), expected.begin(), expected.end()));
+        ASSERT(std::any_of(lst.begin(), lst.end(), [address_of_first_pushed](const auto& item) { return &item == address_of_first_pushed; }));
+        ASSERT(lst.back() == expected.back());
+    }
+
+    {
+        SingleLinkedList<int> lst{ 5, 3, 4, 1, 2 };
+        lst.Sort(std::greater<>());
+        ASSERT((lst == SingleLinkedList<int>{ 5, 4, 3, 2, 1 }));
+        lst.Sort();
+        lst.PushBack(6);
+        ASSERT((lst == SingleLinkedList<int>{ 1, 2, 3, 4, 5, 6 }));
+    }
+
+    // Слияние переносит все узлы другого списка
+    {
+        SingleLinkedList<int> lst{ 1, 4, 6 };
+        SingleLinkedList<int> other{ 2, 3, 7, 8 };
+        lst.Merge(other);
+        ASSERT((lst == SingleLinkedList<int>{ 1, 2, 3, 4, 6, 7, 8 }));
+        ASSERT_EQUAL(lst.GetSize(), 7u);
+        ASSERT_EQUAL(lst.back(), 8);
+        ASSERT(other.IsEmpty());
+        other.PushBack(9);
+        lst.Merge(std::move(other));
+        ASSERT_EQUAL(lst.back(), 9);
+    }
+
+    // При исключении в функции сравнения элементы не теряются
+    {
+        SingleLinkedList<int> lst{ 5, 3, 4, 1, 2, 8, 7, 6 };
+        int comparisons = 0;
+        try {
+            lst.Sort([&comparisons](int lhs, int rhs) {
+                if (++comparisons == 6) throw std::runtime_error("comparison failed"s);
+                return lhs < rhs;
+            });
+            ASSERT_HINT(false, "exception expected"s);
+        }
+        catch (const std::runtime_error&) {
+            ASSERT_EQUAL(lst.GetSize(), 8u);
+            ASSERT_EQUAL(static_cast<size_t>(std::distance(lst.begin(), lst.end())), 8u);
+            lst.Sort();
+            ASSERT((lst == SingleLinkedList<int>{ 1, 2, 3, 4, 5, 6, 7, 8 }));
+            ASSERT_EQUAL(lst.back(), 8);
+        }
+    }
+
+    // Сортировка за O(n log n), слияние за O(n)
+    {
+        std::mt19937 generator(3);
+        const auto make_shuffled = [&generator](size_t n) {
+            std::vector<int> values(n);
+            std::iota(values.begin(), values.end(), 0);
+            std::shuffle(values.begin(), values.end(), generator);
+            return SingleLinkedList<int>(values.begin(), values.end());
+        };
+        const auto sort = [](SingleLinkedList<int>& lst) {
+            lst.Sort();
+        };
+        ASSERT_COMPLEXITY(Complexity::Linearithmic, 1u << 14, make_shuffled, sort);
+
+        const auto make_pair_of_lists = [](size_t n) {
+            return std::make_pair(MakeIotaList<SingleLinkedList<int>>(n), MakeIotaList<SingleLinkedList<int>>(n));
+        };
+        const auto merge = [](std::pair<SingleLinkedList<int>, SingleLinkedList<int>>& lists) {
+            lists.first.Merge(lists.second);
+        };
+        ASSERT_COMPLEXITY(Complexity::Linear, 1u << 16, make_pair_of_lists, merge);
+    }
+}
+
+// UNIT-TEST: Проверка Unique, Reverse и RemoveIf
+void UnitTestUniqueReverseRemoveIf() {
+    {
+        SingleLinkedList<int> lst{ 1, 1, 2, 3, 3, 3, 1, 4, 4 };
+        ASSERT_EQUAL(lst.Unique(), 4u);
+        ASSERT((lst == SingleLinkedList<int>{ 1, 2, 3, 1, 4 }));
+        ASSERT_EQUAL(lst.GetSize(), 5u);
+        ASSERT_EQUAL(lst.back(), 4);
+
+        // Предикат сравнивает следующий элемент с первым элементом группы
+        ASSERT_EQUAL(lst.Unique([](int lhs, int rhs) { return lhs + 1 == rhs; }), 1u);
+        ASSERT((lst == SingleLinkedList<int>{ 1, 3, 1, 4 }));
+    }
+
+    {
+        SingleLinkedList<int> lst{ 1, 2, 3 };
+        lst.Reverse();
+        ASSERT((lst == SingleLinkedList<int>{ 3, 2, 1 }));
+        lst.PushBack(0);
+        ASSERT((lst == SingleLinkedList<int>{ 3, 2, 1, 0 }));
+
+        SingleLinkedList<int> empty;
+        empty.Reverse();
+        ASSERT(empty.IsEmpty());
+    }
+
+    {
+        SingleLinkedList<int> lst{ 1, 2, 3, 4, 5, 6 };
+        ASSERT_EQUAL(lst.RemoveIf([](int value) { return value % 2 == 0; }), 3u);
+        ASSERT((lst == SingleLinkedList<int>{ 1, 3, 5 }));
+        ASSERT_EQUAL(lst.back(), 5);
+        ASSERT_EQUAL(lst.RemoveIf([](int) { return true; }), 3u);
+        ASSERT(lst.IsEmpty());
+        lst.PushBack(7);
+        ASSERT((lst == SingleLinkedList<int>{ 7 }));
+    }
+
+    // Разворот и удаление по условию проходят список один раз
+    {
+        const auto reverse = [](SingleLinkedList<int>& lst) {
+            lst.Reverse();
+        };
+        const auto remove_if = [](SingleLinkedList<int>& lst) {
+            lst.RemoveIf([](int value) { return value % 2 == 0; });
+        };
+        ASSERT_COMPLEXITY(Complexity::Linear, 1u << 16, MakeIotaList<SingleLinkedList<int>>, reverse);
+        ASSERT_COMPLEXITY(Complexity::Linear, 1u << 16, MakeIotaList<SingleLinkedList<int>>, remove_if);
+    }
+}
+
+// UNIT-TEST: Проверка переноса узлов между списками (SpliceAfter)
+void UnitTestSpliceAfter() {
+    // Перенос всего списка не выделяет новых узлов
+    {
+        SingleLinkedList<int, NodePoolAllocator<int>> lst{ 1, 5 };
+        SingleLinkedList<int, NodePoolAllocator<int>> other(lst.get_allocator());
+        other.PushBack(2);
+        other.PushBack(3);
+        other.PushBack(4);
+        const NodePool& pool = *lst.get_allocator().GetPool();
+        ASSERT_EQUAL(pool.GetLiveCount(), 5u);
+
+        lst.SpliceAfter(lst.cbegin(), other);
+        ASSERT((lst == SingleLinkedList<int, NodePoolAllocator<int>>{ 1, 2, 3, 4, 5 }));
+        ASSERT_EQUAL(lst.GetSize(), 5u);
+        ASSERT(other.IsEmpty());
+        ASSERT_EQUAL(pool.GetLiveCount(), 5u);
+
+        // Перенос в конец обновляет последний элемент
+        other.PushBack(6);
+        lst.SpliceAfter(lst.cbefore_end(), other);
+        ASSERT_EQUAL(lst.back(), 6);
+        other.PushBack(7);
+        ASSERT_EQUAL(other.GetSize(), 1u);
+    }
+
+    // Перенос одного элемента
+    {
+        SingleLinkedList<int> lst{ 1, 2 };
+        SingleLinkedList<int> other{ 3, 4 };
+        lst.SpliceAfter(lst.cbefore_end(), other, other.cbegin());
+        ASSERT((lst == SingleLinkedList<int>{ 1, 2, 4 }));
+        ASSERT((other == SingleLinkedList<int>{ 3 }));
+        ASSERT_EQUAL(lst.back(), 4);
+        ASSERT_EQUAL(other.back(), 3);
+        ASSERT_EQUAL(lst.GetSize(), 3u);
+        ASSERT_EQUAL(other.GetSize(), 1u);
+
+        // Перенос внутри одного списка
+        lst.SpliceAfter(lst.cbefore_begin(), lst, ++lst.cbegin());
+        ASSERT((lst == SingleLinkedList<int>{ 4, 1, 2 }));
+        ASSERT_EQUAL(lst.back(), 2);
+        lst.SpliceAfter(lst.cbefore_end(), lst, lst.cbefore_begin());
+        ASSERT((lst == SingleLinkedList<int>{ 1, 2, 4 }));
+        ASSERT_EQUAL(lst.back(), 4);
+        ASSERT_EQUAL(lst.GetSize(), 3u);
+    }
+
+    // Перенос интервала
+    {
+        SingleLinkedList<int> lst{ 1, 6 };
+        SingleLinkedList<int> other{ 0, 2, 3, 4, 5 };
+        lst.SpliceAfter(lst.cbegin(), other, other.cbegin(), other.cend());
+        ASSERT((lst == SingleLinkedList<int>{ 1, 2, 3, 4, 5, 6 }));
+        ASSERT((other == SingleLinkedList<int>{ 0 }));
+        ASSERT_EQUAL(lst.GetSize(), 6u);
+        ASSERT_EQUAL(other.GetSize(), 1u);
+        ASSERT_EQUAL(other.back(), 0);
+
+        // Перенос интервала в конец того же списка
+        lst.SpliceAfter(lst.cbefore_end(), lst, lst.cbefore_begin(), ++(++(++lst.cbegin())));
+        ASSERT((lst == SingleLinkedList<int>{ 4, 5, 6, 1, 2, 3 }));
+        ASSERT_EQUAL(lst.back(), 3);
+    }
+
+    // Перенос всего списка перецепляет узлы за O(1) независимо от размеров списков
+    {
+        const auto make_pair_of_lists = [](size_t n) {
+            return std::make_pair(MakeIotaList<SingleLinkedList<int>>(n), MakeIotaList<SingleLinkedList<int>>(n));
+        };
+        const auto splice_after = [](std::pair<SingleLinkedList<int>, SingleLinkedList<int>>& lists) {
+            lists.first.SpliceAfter(lists.first.cbegin(), lists.second);
+        };
+        ASSERT_COMPLEXITY(Complexity::Constant, 1u << 16, make_pair_of_lists, splice_after);
+    }
+
+    // Цепочка узлов, созданных вне списка, передаётся списку за O(1); константный итератор
+    // неконстантного списка превращается в изменяемый
+    {
+        using List = SingleLinkedList<int>;
+        List lst{ 1, 4 };
+        List::NodeLink* front = List::CreateDetachedNode(lst.get_allocator(), 2);
+        List::NodeLink* back = List::CreateDetachedNode(lst.get_allocator(), 3);
+        front->next_node = back;
+        lst.AdoptChainAfter(lst.cbegin(), front, back, 2u);
+        ASSERT((lst == List{ 1, 2, 3, 4 }));
+        ASSERT_EQUAL(lst.GetSize(), 4u);
+
+        const List::ConstIterator third = std::next(lst.cbegin(), 2);
+        *lst.MakeMutable(third) = 30;
+        ASSERT((lst == List{ 1, 2, 30, 4 }));
+
+        List::NodeLink* last = List::CreateDetachedNode(lst.get_allocator(), 5);
+        lst.AdoptChainAfter(lst.cbefore_end(), last, last, 1u);
+        ASSERT_EQUAL(lst.back(), 5);
+        lst.PushBack(6);
+        ASSERT((lst == List{ 1, 2, 30, 4, 5, 6 }));
+    }
+}
+
+// UNIT-TEST: Проверка EraseAfter и InsertAfter для интервалов
+void UnitTestRangeInsertEraseAfter() {
+    {
+        SingleLinkedList<int> lst{ 1, 2, 3, 4, 5 };
+        const auto after_erased = lst.EraseAfter(lst.cbegin(), ++(++(++lst.cbegin())));
+        ASSERT((lst == SingleLinkedList<int>{ 1, 4, 5 }));
+        ASSERT_EQUAL(*after_erased, 4);
+        ASSERT_EQUAL(lst.GetSize(), 3u);
+
+        lst.EraseAfter(lst.cbegin(), lst.cend());
+        ASSERT((lst == SingleLinkedList<int>{ 1 }));
+        ASSERT_EQUAL(lst.back(), 1);
+    }
+
+    {
+        const std::vector<int> values{ 2, 3, 4 };
+        SingleLinkedList<int> lst{ 1, 5 };
+        auto last_inserted = lst.InsertAfter(lst.cbegin(), values.begin(), values.end());
+        ASSERT((lst == SingleLinkedList<int>{ 1, 2, 3, 4, 5 }));
+        ASSERT_EQUAL(*last_inserted, 4);
+        ASSERT_EQUAL(lst.GetSize(), 5u);
+
+        last_inserted = lst.InsertAfter(lst.cbefore_end(), values.begin(), values.begin());
+        ASSERT(last_inserted == lst.before_end());
+        lst.InsertAfter(lst.cbefore_end(), values.begin(), values.end());
+        ASSERT_EQUAL(lst.back(), 4);
+        ASSERT_EQUAL(lst.GetSize(), 8u);
+    }
+
+    // При исключении при копировании список не меняется
+    {
+        int copy_counter = 1;
+        std::vector<ThrowOnCopy> values(3u);
+        for (ThrowOnCopy& value : values) {
+            value.countdown_ptr = &copy_counter;
+        }
+        SingleLinkedList<ThrowOnCopy> lst;
+        lst.EmplaceFront();
+        try {
+            lst.InsertAfter(lst.cbegin(), values.begin(), values.end());
+            ASSERT_HINT(false, "exception expected"s);
+        }
+        catch (const std::bad_alloc&) {
+            ASSERT_EQUAL(lst.GetSize(), 1u);
+        }
+    }
+}
+
+// UNIT-TEST: Проверка списка с узлами из пула NodePoolAllocator
+void UnitTestNodePoolAllocator() {
+    using PoolList = SingleLinkedList<int, NodePoolAllocator<int>>;
+
+    // Узлы выдаются пулом и возвращаются в него
+    {
+        PoolList lst{ 1, 2, 3 };
+        const NodePool& pool = *lst.get_allocator().GetPool();
+        ASSERT_EQUAL(pool.GetLiveCount(), 3u);
+
+        lst.PopFront();
+        lst.EraseAfter(lst.cbegin());
+        ASSERT_EQUAL(pool.GetLiveCount(), 1u);
+
+        lst.PushFront(10);
+        lst.InsertAfter(lst.cbegin(), 20);
+        ASSERT((lst == PoolList{ 10, 20, 2 }));
+        ASSERT_EQUAL(pool.GetLiveCount(), 3u);
+
+        // Все узлы пула принадлежат списку - освобождаются разом
+        lst.Clear();
+        ASSERT(lst.IsEmpty());
+        ASSERT_EQUAL(pool.GetLiveCount(), 0u);
+    }
+
+    // Копия списка получает свой пул, а пул с чужими узлами разом не освобождается
+    {
+        PoolList lst{ 1, 2, 3 };
+        PoolList copy(lst);
+        ASSERT(lst == copy);
+        ASSERT(lst.get_allocator() != copy.get_allocator());
+
+        PoolList shared(lst.get_allocator());
+        shared.PushFront(4);
+        lst.Clear();
+        ASSERT_EQUAL(lst.get_allocator().GetPool()->GetLiveCount(), 1u);
+        ASSERT((shared == PoolList{ 4 }));
+
+        copy = shared;
+        ASSERT((copy == PoolList{ 4 }));
+        ASSERT(copy.get_allocator() != shared.get_allocator());
+    }
+
+    // Элементы с нетривиальным деструктором разрушаются при очистке
+    {
+        SingleLinkedList<DeletionSpy, NodePoolAllocator<DeletionSpy>> list{ DeletionSpy{}, DeletionSpy{} };
+        int deletion_counter = 0;
+        for (DeletionSpy& spy : list) {
+            spy.deletion_counter_ptr = &deletion_counter;
+        }
+        list.Clear();
+        ASSERT_EQUAL(deletion_counter, 2);
+        ASSERT_EQUAL(list.get_allocator().GetPool()->GetLiveCount(), 0u);
+    }
+
+    // Копия резервирует блоки подряд: узлы копии лежат в памяти в порядке списка. Присваивание переиспользует
+    // узлы и дописывает остаток начатого чанка, затем продолжает в новом чанке (один разрыв)
+    {
+        PoolList lst;
+        for (int i = 0; i < 1000; ++i) lst.PushBack(i);
+        const auto count_gaps = [](const PoolList& checked) {
+            const auto slot_size = static_cast<std::ptrdiff_t>(checked.get_allocator().GetPool()->GetSlotSize());
+            size_t gaps = 0u;
+            const int* prev = nullptr;
+            for (const int& value : checked) {
+                if (prev && reinterpret_cast<const char*>(&value) - reinterpret_cast<const char*>(prev) != slot_size) {
+                    ++gaps;
+                }
+                prev = &value;
+            }
+            return gaps;
+        };
+
+        const PoolList copy(lst);
+        ASSERT(copy == lst);
+        ASSERT_EQUAL(count_gaps(copy), 0u);
+
+        PoolList assigned{ 1, 2, 3 };
+        assigned = lst;
+        ASSERT(assigned == lst);
+        ASSERT_EQUAL(assigned.get_allocator().GetPool()->GetLiveCount(), lst.GetSize());
+        ASSERT_EQUAL(count_gaps(assigned), 1u);
+    }
+}
+
+#if defined(__cpp_constexpr_dynamic_alloc) && defined(__cpp_lib_constexpr_dynamic_alloc)
+// Таблица, вычисленная списком при компиляции: различные значения по убыванию
+constexpr std::array<int, 4> BuildDescendingUniqueTable() {
+    SingleLinkedList<int> lst = { 3, 1, 4, 1, 5 };
+    lst.PushBack(3);
+    lst.Sort(std::greater<>());
+    lst.Unique();
+
+    std::array<int, 4> table{};
+    size_t i = 0u;
+    for (int value : lst) table[i++] = value;
+    return table;
+}
+
+// Проверка основных операций списка в константном выражении
+constexpr bool CheckListAtCompileTime() {
+    SingleLinkedList<int> lst;
+    lst.PushFront(2);
+    lst.PushBack(3);
+    lst.InsertAfter(lst.cbefore_begin(), 1);
+    lst.EraseAfter(lst.cbegin());
+    SingleLinkedList<int> copy(lst);
+    copy.Reverse();
+    SingleLinkedList<int> moved(std::move(copy));
+    return lst.GetSize() == 2u && lst.front() == 1 && lst.back() == 3
+        && moved.front() == 3 && copy.IsEmpty() && moved != lst;
+}
+#endif
+
+// UNIT-TEST: Проверка списка в константных выражениях (C++20)
+void UnitTestConstexprList() {
+#if defined(__cpp_constexpr_dynamic_alloc) && defined(__cpp_lib_constexpr_dynamic_alloc)
+    static_assert(CheckListAtCompileTime());
+    constexpr std::array<int, 4> table = BuildDescendingUniqueTable();
+    static_assert(table == std::array<int, 4>{ 5, 4, 3, 1 });
+    ASSERT(CheckListAtCompileTime());
+    ASSERT((BuildDescendingUniqueTable() == table));
+#endif
+}
+
+// Структура подопытного объекта, который выбрасывает исключение при N-ом копировании конструктором,
+// но присваивается без исключений (узлы списков из таких объектов переиспользуются при присваивании)
+struct ThrowOnCopyConstruct {
+    ThrowOnCopyConstruct(int v, int* countdown) noexcept : value(v), countdown_ptr(countdown) { }
+
+    ThrowOnCopyConstruct(const ThrowOnCopyConstruct& other) : value(other.value), countdown_ptr(other.countdown_ptr) {
+        if (countdown_ptr) {
+            if (*countdown_ptr == 0) throw std::bad_alloc();
+            else --(*countdown_ptr);
+        }
+    }
+
+    ThrowOnCopyConstruct& operator=(const ThrowOnCopyConstruct& rhs) noexcept = default;
+
+    bool operator == (const ThrowOnCopyConstruct& rhs) const noexcept { return value == rhs.value; }
+
+    int value = 0;
+    int* countdown_ptr = nullptr;
+};
+
+// UNIT-TEST: Проверка присваивания, Assign и Resize с переиспользованием узлов
+void UnitTestAssignAndResize() {
+    using StatsList = SingleLinkedList<int, std::allocator<int>, CountingListStats>;
+
+    // Присваивание списка того же размера не выделяет и не освобождает узлы
+    {
+        const StatsList source{ 1, 2, 3, 4 };
+        StatsList snapshot{ 5, 6, 7, 8 };
+        const int* first_element = &snapshot.front();
+        snapshot = source;
+        ASSERT(snapshot == source);
+        ASSERT_EQUAL(&snapshot.front(), first_element);
+        ASSERT_EQUAL(snapshot.GetStats().GetNodeAllocations(), 4u);
+        ASSERT_EQUAL(snapshot.GetStats().GetNodeFrees(), 0u);
+
+        // Выделяется или освобождается только разница в размерах
+        const StatsList longer{ 1, 2, 3, 4, 5, 6 };
+        snapshot = longer;
+        ASSERT(snapshot == longer);
+        ASSERT_EQUAL(snapshot.GetStats().GetNodeAllocations(), 6u);
+        const StatsList shorter{ 9 };
+        snapshot = shorter;
+        ASSERT(snapshot == shorter);
+        ASSERT_EQUAL(snapshot.GetStats().GetNodeFrees(), 5u);
+        ASSERT_EQUAL(&snapshot.back(), first_element);
+        snapshot.PushBack(10);
+        ASSERT_EQUAL(snapshot.back(), 10);
+        snapshot = StatsList();
+        ASSERT(snapshot.IsEmpty());
+        ASSERT(snapshot.before_end() == snapshot.before_begin());
+    }
+
+    // Assign из интервала, из части самого списка, из потока и count копий значения
+    {
+        SingleLinkedList<int> lst{ 1, 2, 3 };
+        const vector<int> values{ 4, 5, 6, 7, 8 };
+        lst.Assign(values.begin(), values.end());
+        ASSERT((lst == SingleLinkedList<int>{ 4, 5, 6, 7, 8 }));
+        lst.Assign(next(lst.begin(), 2), lst.end());
+        ASSERT((lst == SingleLinkedList<int>{ 6, 7, 8 }));
+        ASSERT_EQUAL(lst.back(), 8);
+
+        istringstream input("1 2 3 4"s);
+        lst.Assign(istream_iterator<int>(input), istream_iterator<int>());
+        ASSERT((lst == SingleLinkedList<int>{ 1, 2, 3, 4 }));
+        lst.Assign({ 9, 8 });
+        ASSERT((lst == SingleLinkedList<int>{ 9, 8 }));
+        lst.Assign(3u, 7);
+        ASSERT((lst == SingleLinkedList<int>{ 7, 7, 7 }));
+        lst.Assign(1u, lst.back());
+        ASSERT((lst == SingleLinkedList<int>{ 7 }));
+        lst.PushBack(1);
+        ASSERT_EQUAL(lst.back(), 1);
+
+        SingleLinkedList<string> words{ "a"s, "b"s };
+        words.Assign(3u, "c"s);
+        ASSERT((words == SingleLinkedList<string>{ "c"s, "c"s, "c"s }));
+    }
+
+    // Resize
+    {
+        SingleLinkedList<int> lst{ 1, 2, 3 };
+        lst.Resize(5u);
+        ASSERT((lst == SingleLinkedList<int>{ 1, 2, 3, 0, 0 }));
+        lst.Resize(2u);
+        ASSERT((lst == SingleLinkedList<int>{ 1, 2 }));
+        ASSERT_EQUAL(lst.back(), 2);
+        lst.Resize(4u, 9);
+        ASSERT((lst == SingleLinkedList<int>{ 1, 2, 9, 9 }));
+        lst.Resize(0u);
+        ASSERT(lst.IsEmpty());
+        ASSERT(lst.before_end() == lst.before_begin());
+        lst.Resize(1u, 5);
+        ASSERT_EQUAL(lst.front(), 5);
+    }
+
+    // Строгая гарантия: при исключении во время создания недостающих узлов список не меняется
+    {
+        int countdown = 100;
+        SingleLinkedList<ThrowOnCopyConstruct> lst;
+        lst.PushBack(ThrowOnCopyConstruct(1, &countdown));
+        const SingleLinkedList<ThrowOnCopyConstruct> original(lst);
+
+        SingleLinkedList<ThrowOnCopyConstruct> longer;
+        for (int i = 0; i < 5; ++i) longer.PushBack(ThrowOnCopyConstruct(i + 10, &countdown));
+
+        countdown = 2;
+        bool thrown = false;
+        try {
+            lst = longer;
+        } catch (const bad_alloc&) {
+            thrown = true;
+        }
+        ASSERT(thrown);
+        ASSERT(lst == original);
+
+        countdown = 1;
+        thrown = false;
+        try {
+            lst.Resize(4u, ThrowOnCopyConstruct(0, &countdown));
+        } catch (const bad_alloc&) {
+            thrown = true;
+        }
+        ASSERT(thrown);
+        ASSERT(lst == original);
+        ASSERT_EQUAL(lst.GetSize(), 1u);
+
+        countdown = 100;
+        lst = longer;
+        ASSERT(lst == longer);
+    }
+
+    // Элементы без присваивания без исключений: список собирается заново, при исключении не меняется
+    {
+        int countdown = 100;
+        SingleLinkedList<ThrowOnCopy> lst{ ThrowOnCopy(countdown), ThrowOnCopy(countdown) };
+        const vector<ThrowOnCopy> values(3u, ThrowOnCopy(countdown));
+        countdown = 1;
+        bool thrown = false;
+        try {
+            lst.Assign(values.begin(), values.end());
+        } catch (const bad_alloc&) {
+            thrown = true;
+        }
+        ASSERT(thrown);
+        ASSERT_EQUAL(lst.GetSize(), 2u);
+        countdown = 100;
+        lst.Assign(values.begin(), values.end());
+        ASSERT_EQUAL(lst.GetSize(), 3u);
+    }
+}
+
+// UNIT-TEST: Проверка политики статистики списка
+void UnitTestListStats() {
+    using StatsList = SingleLinkedList<int, std::allocator<int>, CountingListStats>;
+
+    // Выключенная статистика не увеличивает размер списка
+    static_assert(sizeof(SingleLinkedList<int>) == sizeof(SingleLinkedList<int, std::allocator<int>, NoListStats>));
+    static_assert(sizeof(SingleLinkedList<int>) < sizeof(StatsList));
+
+    {
+        StatsList lst{ 1, 2, 3 };
+        ASSERT_EQUAL(lst.GetStats().GetNodeAllocations(), 3u);
+        ASSERT_EQUAL(lst.GetStats().GetPeakSize(), 3u);
+
+        lst.PushBack(4);
+        lst.PushFront(0);
+        lst.InsertAfter(lst.cbegin(), 10);
+        ASSERT_EQUAL(lst.GetStats().GetNodeAllocations(), 6u);
+        ASSERT_EQUAL(lst.GetStats().GetPeakSize(), 6u);
+        ASSERT_EQUAL(lst.GetStats().GetTraversalSteps(), 0u);
+
+        // PopBack проходит по списку до предпоследнего узла
+        lst.PopBack();
+        ASSERT_EQUAL(lst.GetStats().GetTraversalSteps(), 5u);
+        lst.PopFront();
+        ASSERT_EQUAL(lst.GetStats().GetNodeFrees(), 2u);
+        ASSERT_EQUAL(lst.GetStats().GetPeakSize(), 6u);
+
+        lst.Clear();
+        ASSERT_EQUAL(lst.GetStats().GetNodeFrees(), 6u);
+        ASSERT_EQUAL(lst.GetStats().GetClearCount(), 1u);
+        ASSERT(lst.GetStats().GetClearMaxTime() <= lst.GetStats().GetClearTotalTime());
+
+        // Очистка пустого списка не считается
+        lst.Clear();
+        ASSERT_EQUAL(lst.GetStats().GetClearCount(), 1u);
+    }
+
+    // Узлы временных списков учитываются в статистике списка, выполнившего операцию
+    {
+        const StatsList source{ 1, 2, 3, 4 };
+        StatsList lst{ 5 };
+        lst = source;
+        ASSERT_EQUAL(lst.GetStats().GetNodeAllocations(), 4u);
+        ASSERT_EQUAL(lst.GetStats().GetNodeFrees(), 0u);
+        ASSERT_EQUAL(lst.GetStats().GetPeakSize(), 4u);
+
+        const std::vector<int> values{ 6, 7 };
+        lst.InsertAfter(lst.cbefore_begin(), values.begin(), values.end());
+        ASSERT_EQUAL(lst.GetStats().GetNodeAllocations(), 6u);
+        ASSERT_EQUAL(lst.GetStats().GetPeakSize(), 6u);
+    }
+
+    // Статистика выводится в поток
+    {
+        StatsList lst{ 1, 2 };
+        std::ostringstream os;
+        os << lst << ' ' << lst.GetStats();
+        ASSERT(os.str().rfind("{1, 2} {allocations: 2, frees: 0, traversal steps: 0, peak size: 2, clears: 0"s, 0) == 0u);
+    }
+}
+
+// UNIT-TEST: Проверка параллельных алгоритмов над списком
+void UnitTestParallelAlgorithms() {
+    ThreadPool pool(4u);
+    ASSERT_EQUAL(pool.GetThreadCount(), 4u);
+
+    SingleLinkedList<int> lst;
+    for (int i = 0; i < 100000; ++i) {
+        lst.PushBack(i);
+    }
+
+    // Разбиение на отрезки покрывает весь список
+    {
+        const ListSegments<const SingleLinkedList<int>> segments(lst);
+        size_t covered = 0u;
+        for (size_t i = 0u; i < segments.GetCount(); ++i) {
+            ASSERT_EQUAL(*segments.GetBegin(i), static_cast<int>(covered));
+            covered += segments.GetLength(i);
+        }
+        ASSERT_EQUAL(covered, lst.GetSize());
+        ASSERT(segments.GetCount() > 1u);
+    }
+
+    ParallelForEach(pool, lst, [](int& value) { value *= 2; });
+    ASSERT_EQUAL(lst.front(), 0);
+    ASSERT_EQUAL(lst.back(), 199998);
+
+    const long long sum = ParallelReduce(pool, lst, 0ll);
+    ASSERT_EQUAL(sum, 9999900000ll);
+    ASSERT_EQUAL(ParallelCountIf(pool, lst, [](int value) { return value % 3 == 0; }), 33334u);
+
+    SingleLinkedList<std::string> strings;
+    for (size_t i = 0u; i < lst.GetSize(); ++i) {
+        strings.PushFront(std::string());
+    }
+    ParallelTransform(pool, lst, strings, [](int value) { return std::to_string(value); });
+    ASSERT_EQUAL(strings.front(), "0"s);
+    ASSERT_EQUAL(strings.back(), "199998"s);
+
+    // Операция не обязана быть коммутативной: частичные результаты сворачиваются по порядку
+    const std::string concatenated = ParallelReduce(pool, strings, std::string(), [](std::string lhs, const std::string& rhs) {
+        return lhs.size() < 20u ? lhs + rhs : lhs;
+    });
+    ASSERT_EQUAL(concatenated.substr(0u, 10u), "0246810121"s);
+
+    // Результат свёртки не зависит от количества потоков
+    {
+        SingleLinkedList<double> values;
+        std::mt19937 generator(42);
+        for (int i = 0; i < 50000; ++i) {
+            values.PushBack(std::uniform_real_distribution<double>(-1e6, 1e6)(generator));
+        }
+        ThreadPool single(1u);
+        const double expected = ParallelReduce(single, values, 0.0);
+        for (int repeat = 0; repeat < 5; ++repeat) {
+            ASSERT(ParallelReduce(pool, values, 0.0) == expected);
+        }
+    }
+
+    // Пустой список и исключения
+    {
+        SingleLinkedList<int> empty;
+        ASSERT_EQUAL(ParallelReduce(pool, empty, 7), 7);
+        ASSERT_EQUAL(ParallelCountIf(pool, empty, [](int) { return true; }), 0u);
+
+        bool thrown = false;
+        try {
+            ParallelForEach(pool, lst, [](int value) { if (value == 100000) throw std::runtime_error("stop"); });
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        ASSERT(thrown);
+        ASSERT_EQUAL(ParallelCountIf(pool, lst, [](int value) { return value >= 100000; }), 50000u);
+    }
+}
+
+// UNIT-TEST: Проверка двоичной сериализации списка
+void UnitTestBinarySerialization() {
+    // Тривиально копируемые элементы, в том числе больше одного блока
+    {
+        struct Point { int x; int y; };
+        SingleLinkedList<Point> points;
+        for (int i = 0; i < 10000; ++i) {
+            points.PushBack({ i, -i });
+        }
+
+        std::stringstream stream;
+        WriteBinary(stream, points);
+        const SingleLinkedList<Point> restored(BinaryListReader<Point>(stream).begin(), BinaryListReader<Point>::Iterator());
+        ASSERT_EQUAL(restored.GetSize(), points.GetSize());
+        ASSERT(std::equal(points.begin(), points.end(), restored.begin(), restored.end(),
+                          [](const Point& lhs, const Point& rhs) { return lhs.x == rhs.x && lhs.y == rhs.y; }));
+    }
+
+    // Строки и конструктор из потока
+    {
+        const SingleLinkedList<std::string> words{ ""s, "single"s, "linked list with a long string value"s };
+        std::stringstream stream;
+        WriteBinary(stream, words);
+
+        BinaryListReader<std::string> reader(stream);
+        const SingleLinkedList<std::string> restored(reader.begin(), reader.end());
+        ASSERT(restored == words);
+    }
+
+    // ReadBinary добавляет элементы в конец; пустой список
+    {
+        std::stringstream stream;
+        WriteBinary(stream, SingleLinkedList<int>{ 3, 4 });
+        WriteBinary(stream, SingleLinkedList<int>());
+
+        SingleLinkedList<int> lst{ 1, 2 };
+        ReadBinary(stream, lst);
+        ASSERT((lst == SingleLinkedList<int>{ 1, 2, 3, 4 }));
+        ASSERT_EQUAL(lst.back(), 4);
+        ReadBinary(stream, lst);
+        ASSERT_EQUAL(lst.GetSize(), 4u);
+    }
+
+    // Потоковая запись и чтение по одному элементу
+    {
+        std::stringstream stream;
+        BinaryListWriter<long long> writer(stream);
+        for (long long i = 0; i < 20000; ++i) {
+            writer.Write(i * i);
+        }
+        writer.Finish();
+
+        BinaryListReader<long long> reader(stream);
+        long long i = 0;
+        for (std::optional<long long> value = reader.Read(); value; value = reader.Read(), ++i) {
+            ASSERT_EQUAL(*value, i * i);
+        }
+        ASSERT_EQUAL(i, 20000ll);
+    }
+
+    // Запись интервала тривиально копируемых элементов целыми кусками даёт те же байты, что и поэлементная
+    // запись; ReadChunk возвращает элементы блоками
+    {
+        std::vector<int> values(10000);
+        for (size_t i = 0; i < values.size(); ++i) {
+            values[i] = static_cast<int>(i * 7);
+        }
+
+        std::stringstream by_element;
+        BinaryListWriter<int> element_writer(by_element);
+        for (const int value : values) {
+            element_writer.Write(value);
+        }
+        element_writer.Finish();
+
+        std::stringstream by_range;
+        BinaryListWriter<int> range_writer(by_range);
+        range_writer.Write(values.data(), values.data() + 3);
+        range_writer.Write(values.begin() + 3, values.end());
+        range_writer.Finish();
+        ASSERT(by_element.str() == by_range.str());
+
+        BinaryListReader<int> reader(by_range);
+        ASSERT_EQUAL(*reader.Read(), 0);
+        std::vector<int> chunk;
+        std::vector<int> restored{ 0 };
+        size_t chunks = 0u;
+        while (reader.ReadChunk(chunk) > 0u) {
+            ASSERT(chunk.size() <= binary_format::kChunkElements);
+            restored.insert(restored.end(), chunk.begin(), chunk.end());
+            ++chunks;
+        }
+        ASSERT(restored == values);
+        ASSERT_EQUAL(chunks, 3u);
+        ASSERT(!reader.Read());
+    }
+
+    // Ошибки формата: другой тип элементов и обрезанный поток. Список при ошибке не меняется
+    {
+        std::stringstream stream;
+        WriteBinary(stream, SingleLinkedList<int>{ 1, 2, 3 });
+        const std::string bytes = stream.str();
+
+        bool thrown = false;
+        try {
+            std::stringstream wrong_type(bytes);
+            SingleLinkedList<double> lst;
+            ReadBinary(wrong_type, lst);
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        ASSERT(thrown);
+
+        thrown = false;
+        SingleLinkedList<int> lst{ 0 };
+        try {
+            std::stringstream truncated(bytes.substr(0u, bytes.size() - 12u));
+            ReadBinary(truncated, lst);
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        ASSERT(thrown);
+        ASSERT((lst == SingleLinkedList<int>{ 0 }));
+    }
+
+    // Повреждённый размер блока строк (почти 4 ГиБ при нескольких байтах данных): ошибка формата
+    // без попытки выделить память под весь заявленный блок
+    {
+        std::stringstream stream;
+        WriteBinary(stream, SingleLinkedList<std::string>{ "corrupted"s });
+        std::string bytes = stream.str();
+        const uint32_t huge_bytes = std::numeric_limits<uint32_t>::max();
+        std::memcpy(bytes.data() + 12u, &huge_bytes, sizeof(huge_bytes));
+
+        bool thrown = false;
+        const size_t allocated_before = heap_allocation_counter::GetAllocatedBytes();
+        try {
+            std::stringstream corrupted(bytes);
+            SingleLinkedList<std::string> lst;
+            ReadBinary(corrupted, lst);
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        ASSERT(thrown);
+        ASSERT(heap_allocation_counter::GetAllocatedBytes() - allocated_before < (1u << 20));
+    }
+}
+
+// Аллокатор, считающий все выделения узлов (всех списков с этим аллокатором, в том числе копий)
+template <typename Type>
+struct CountingAllocator {
+    using value_type = Type;
+
+    inline static size_t allocations = 0u;
+
+    CountingAllocator() = default;
+    template <typename Other>
+    CountingAllocator(const CountingAllocator<Other>&) noexcept { }
+
+    Type* allocate(size_t n) {
+        ++CountingAllocator<void>::allocations;
+        return std::allocator<Type>().allocate(n);
+    }
+
+    void deallocate(Type* ptr, size_t n) noexcept { std::allocator<Type>().deallocate(ptr, n); }
+
+    template <typename Other>
+    bool operator == (const CountingAllocator<Other>&) const noexcept { return true; }
+    template <typename Other>
+    bool operator != (const CountingAllocator<Other>&) const noexcept { return false; }
+};
+
+// UNIT-TEST: Проверка ленивых представлений Filter/Map/Take/Chunk: цепочка представлений не выделяет узлов
+void UnitTestListViews() {
+    using List = SingleLinkedList<int, CountingAllocator<int>>;
+    List lst{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+
+#if __cplusplus >= 202002L
+    static_assert(std::ranges::forward_range<List>);
+    static_assert(std::ranges::forward_range<const List>);
+    static_assert(std::forward_iterator<List::Iterator>);
+    static_assert(std::ranges::view<decltype(lst | Filter([](int) { return true; }) | Take(1u))>);
+    static_assert(std::ranges::forward_range<decltype(lst | Map([](int x) { return x; }) | Chunk(2u))>);
+#endif
+
+    const int divisor = 2;
+    const size_t allocations_before = CountingAllocator<void>::allocations;
+    {
+        // Нечётные элементы в квадрате, первые три, кусками по два
+        const auto pipeline = lst
+            | Filter([divisor](int x) { return x % divisor != 0; })
+            | Map([](int x) { return x * x; })
+            | Take(3u)
+            | Chunk(2u);
+
+        vector<vector<int>> chunks;
+        chunks.reserve(4u);
+        for (const auto& chunk : pipeline) {
+            chunks.emplace_back();
+            chunks.back().reserve(2u);
+            for (int value : chunk) {
+                chunks.back().push_back(value);
+            }
+        }
+        ASSERT((chunks == vector<vector<int>>{ { 1, 9 }, { 25 } }));
+
+        // Представление можно обходить повторно
+        ASSERT_EQUAL(std::distance(pipeline.begin(), pipeline.end()), 2);
+    }
+    ASSERT_EQUAL(CountingAllocator<void>::allocations, allocations_before);
+
+    // Представления ссылаются на элементы списка: через Filter их можно менять
+    for (int& value : lst | Filter([](int x) { return x > 8; })) {
+        value = 0;
+    }
+    ASSERT((lst == List{ 1, 2, 3, 4, 5, 6, 7, 8, 0, 0 }));
+
+    // Take не продвигает Filter дальше последнего взятого элемента: предикат вызывается только
+    // для просмотренных элементов
+    {
+        size_t predicate_calls = 0u;
+        const auto first_odd = lst | Filter([&predicate_calls](int x) { ++predicate_calls; return x % 2 != 0; }) | Take(1u);
+        ASSERT_EQUAL(std::distance(first_odd.begin(), first_odd.end()), 1);
+        ASSERT_EQUAL(predicate_calls, 1u);
+    }
+
+    // Крайние случаи: пустой список, Take(0) и Take больше размера, неполный последний кусок
+    const List empty;
+    const auto empty_view = empty | Filter([](int) { return true; }) | Map([](int x) { return x; });
+    ASSERT(empty_view.begin() == empty_view.end());
+    const auto none = lst | Take(0u);
+    ASSERT(none.begin() == none.end());
+    const auto all = lst | Take(100u);
+    ASSERT_EQUAL(std::distance(all.begin(), all.end()), 10);
+    const auto chunks = lst | Chunk(4u);
+    ASSERT_EQUAL(std::distance(chunks.begin(), chunks.end()), 3);
+    const auto last_chunk = *std::next(chunks.begin(), 2);
+    ASSERT_EQUAL(std::distance(last_chunk.begin(), last_chunk.end()), 2);
+}
+
+// Запуск Unit-тестов для односвязного списка
+void RunTestSingleLinkedList() {
+    RUN_TEST(UnitTestPopFront);
+    RUN_TEST(UnitTestBeforeBegin);
+    RUN_TEST(UnitTestInsertAfter);
+    RUN_TEST(UnitTestNoExcept);
+    RUN_TEST(UnitTestEraseAfter);
+    RUN_TEST(UnitTestMoveAndEmplace);
+    RUN_TEST(UnitTestBackAccess);
+    RUN_TEST(UnitTestSortAndMerge);
+    RUN_TEST(UnitTestUniqueReverseRemoveIf);
+    RUN_TEST(UnitTestSpliceAfter);
+    RUN_TEST(UnitTestRangeInsertEraseAfter);
+    RUN_TEST(UnitTestNodePoolAllocator);
+    RUN_TEST(UnitTestConstexprList);
+    RUN_TEST(UnitTestAssignAndResize);
+    RUN_TEST(UnitTestListStats);
+    RUN_TEST(UnitTestParallelAlgorithms);
+    RUN_TEST(UnitTestBinarySerialization);
+    RUN_TEST(UnitTestListViews);
+}
+
+// UNIT-TEST: Проверка InsertAfter/EraseAfter развёрнутого списка в сравнении с std::vector
+void UnitTestUnrolledInsertEraseAfter() {
+    UnrolledSingleLinkedList<int, 4u> lst;
+    std::vector<int> expected;
+    std::mt19937 generator(42);
+
+    for (int step = 0; step < 2000; ++step) {
+        const size_t pos = std::uniform_int_distribution<size_t>(0u, expected.size())(generator);
+        auto it = lst.cbefore_begin();
+        for (size_t i = 0u; i < pos; ++i) ++it;
+
+        if (pos < expected.size() && generator() % 5u < 2u) {
+            const auto next = lst.EraseAfter(it);
+            expected.erase(expected.begin() + pos);
+            ASSERT((pos == expected.size()) == (next == lst.end()));
+            if (pos < expected.size()) ASSERT_EQUAL(*next, expected[pos]);
+        } else {
+            const auto inserted = lst.InsertAfter(it, step);
+            expected.insert(expected.begin() + pos, step);
+            ASSERT_EQUAL(*inserted, step);
+        }
+
+        ASSERT_EQUAL(lst.GetSize(), expected.size());
+        ASSERT(std::equal(lst.begin(), lst.end(), expected.begin(), expected.end()));
+        if (!expected.empty()) ASSERT_EQUAL(lst.back(), expected.back());
+    }
+}
+
+// UNIT-TEST: Проверка основного интерфейса развёрнутого списка
+void UnitTestUnrolledBasics() {
+    using List = UnrolledSingleLinkedList<int, 3u>;
+    {
+        List lst{ 1, 2, 3, 4, 5 };
+        ASSERT(++lst.before_begin() == lst.begin());
+        lst.PushFront(0);
+        lst.PushBack(6);
+        lst.PopFront();
+        ASSERT((lst == List{ 1, 2, 3, 4, 5, 6 }));
+        ASSERT((lst < List{ 1, 2, 4 }));
+
+        List copy(lst);
+        List moved(std::move(lst));
+        ASSERT(lst.IsEmpty());
+        ASSERT(copy == moved);
+        lst.PushBack(7);
+        ASSERT((lst == List{ 7 }));
+
+        moved.swap(lst);
+        ASSERT((moved == List{ 7 }));
+        ASSERT_EQUAL(lst.GetSize(), 6u);
+    }
+
+    // Элементы разрушаются при удалении и очистке
+    {
+        UnrolledSingleLinkedList<DeletionSpy, 2u> list{ DeletionSpy{}, DeletionSpy{}, DeletionSpy{} };
+        int deletion_counter = 0;
+        for (DeletionSpy& spy : list) {
+            spy.deletion_counter_ptr = &deletion_counter;
+        }
+        list.EraseAfter(list.cbegin());
+        ASSERT_EQUAL(deletion_counter, 1);
+        list.Clear();
+        ASSERT_EQUAL(deletion_counter, 3);
+    }
+
+    // Добавление в начало списка не зависит от его размера
+    const auto push_front = [](UnrolledSingleLinkedList<int>& lst) {
+        for (int i = 0; i < 64; ++i) lst.PushFront(i);
+    };
+    ASSERT_COMPLEXITY(Complexity::Constant, 1u << 16, MakeIotaList<UnrolledSingleLinkedList<int>>, push_front);
+}
+
+// Запуск Unit-тестов для развёрнутого односвязного списка
+void RunTestUnrolledSingleLinkedList() {
+    RUN_TEST(UnitTestUnrolledInsertEraseAfter);
+    RUN_TEST(UnitTestUnrolledBasics);
+}
+
+// UNIT-TEST: Проверка InsertAfter/EraseAfter компактного списка в сравнении с std::vector
+void UnitTestCompactInsertEraseAfter() {
+    CompactSingleLinkedList<std::string> lst;
+    std::vector<std::string> expected;
+    std::mt19937 generator(42);
+
+    for (int step = 0; step < 2000; ++step) {
+        const size_t pos = std::uniform_int_distribution<size_t>(0u, expected.size())(generator);
+        auto it = lst.cbefore_begin();
+        for (size_t i = 0u; i < pos; ++i) ++it;
+
+        if (pos < expected.size() && generator() % 5u < 2u) {
+            const auto next = lst.EraseAfter(it);
+            expected.erase(expected.begin() + pos);
+            ASSERT((pos == expected.size()) == (next == lst.end()));
+            if (pos < expected.size()) ASSERT_EQUAL(*next, expected[pos]);
+        } else {
+            const std::string value = "value with heap storage #"s + std::to_string(step);
+            const auto inserted = lst.InsertAfter(it, value);
+            expected.insert(expected.begin() + pos, value);
+            ASSERT_EQUAL(*inserted, value);
+        }
+
+        ASSERT_EQUAL(lst.GetSize(), expected.size());
+        ASSERT(std::equal(lst.begin(), lst.end(), expected.begin(), expected.end()));
+        if (!expected.empty()) ASSERT_EQUAL(lst.back(), expected.back());
+    }
+}
+
+// UNIT-TEST: Проверка основного интерфейса компактного списка
+void UnitTestCompactBasics() {
+    using List = CompactSingleLinkedList<int>;
+    {
+        List lst{ 1, 2, 3 };
+        ASSERT(++lst.before_begin() == lst.begin());
+        ASSERT_EQUAL(lst.GetCapacity(), 3u);
+
+        // Итераторы переживают рост массива узлов; элемент самого списка можно добавить в него
+        const auto first = lst.cbegin();
+        const auto last = lst.cbefore_end();
+        lst.PushBack(lst.front());
+        ASSERT(lst.GetCapacity() > 3u);
+        ASSERT_EQUAL(*first, 1);
+        ASSERT_EQUAL(*last, 3);
+        ASSERT((lst == List{ 1, 2, 3, 1 }));
+
+        lst.PopBack();
+        lst.PopFront();
+        lst.EmplaceFront(0);
+        lst.EmplaceBack(4);
+        ASSERT((lst == List{ 0, 2, 3, 4 }));
+        ASSERT((lst < List{ 0, 2, 4 }));
+        ASSERT((lst != List{ 0, 2, 3 }));
+    }
+
+    // Освобождённые узлы переиспользуются, массив не растёт
+    {
+        List lst;
+        lst.Reserve(100u);
+        for (int i = 0; i < 100; ++i) lst.PushBack(i);
+        for (int round = 0; round < 10; ++round) {
+            for (int i = 0; i < 50; ++i) lst.PopFront();
+            for (int i = 0; i < 50; ++i) lst.PushBack(i);
+        }
+        ASSERT_EQUAL(lst.GetSize(), 100u);
+        ASSERT_EQUAL(lst.GetCapacity(), 100u);
+
+        lst.Clear();
+        ASSERT(lst.IsEmpty());
+        ASSERT(lst.begin() == lst.end());
+        lst.PushFront(1);
+        ASSERT_EQUAL(lst.front(), lst.back());
+    }
+
+    // Копирование, перемещение и обмен
+    {
+        const CompactSingleLinkedList<std::string> words{ "a"s, "b"s, "c"s };
+        CompactSingleLinkedList<std::string> copy(words);
+        ASSERT(copy == words);
+
+        CompactSingleLinkedList<std::string> moved(std::move(copy));
+        ASSERT(copy.IsEmpty());
+        ASSERT(moved == words);
+
+        copy = moved;
+        copy.PushBack("d"s);
+        swap(copy, moved);
+        ASSERT_EQUAL(moved.GetSize(), 4u);
+        ASSERT(copy == words);
+
+        moved = std::move(copy);
+        ASSERT(moved == words);
+    }
+
+    // Добавление в конец списка не зависит от его размера. Рост массива узлов даёт O(1) лишь амортизированно,
+    // поэтому массив резервируется заранее
+    const auto make_reserved = [](size_t n) {
+        CompactSingleLinkedList<int> lst = MakeIotaList<CompactSingleLinkedList<int>>(n);
+        lst.Reserve(n + 64u);
+        return lst;
+    };
+    const auto push_back = [](CompactSingleLinkedList<int>& lst) {
+        for (int i = 0; i < 64; ++i) lst.PushBack(i);
+    };
+    ASSERT_COMPLEXITY(Complexity::Constant, 1u << 16, make_reserved, push_back);
+}
+
+// Запуск Unit-тестов для компактного односвязного списка
+void RunTestCompactSingleLinkedList() {
+    RUN_TEST(UnitTestCompactInsertEraseAfter);
+    RUN_TEST(UnitTestCompactBasics);
+}
+
+// UNIT-TEST: Проверка списка с индексом в сравнении с std::vector: доступ по номеру после вставок,
+// удалений (в том числе по устаревшим итераторам), переноса узлов и сортировки
+void UnitTestIndexedList() {
+    IndexedSingleLinkedList<int> lst;
+    vector<int> expected;
+    mt19937 generator(7);
+
+    // Проверка доступа по номеру в нескольких случайных позициях
+    const auto check_access = [&] {
+        ASSERT_EQUAL(lst.GetSize(), expected.size());
+        for (int probe = 0; probe < 4 && !expected.empty(); ++probe) {
+            const size_t index = uniform_int_distribution<size_t>(0u, expected.size() - 1u)(generator);
+            ASSERT_EQUAL(lst.At(index), expected[index]);
+            ASSERT_EQUAL(lst.IndexOf(lst.IteratorAt(index)), index);
+        }
+        ASSERT(lst.IteratorAt(expected.size()) == lst.end());
+    };
+
+    for (int step = 0; step < 4000; ++step) {
+        const unsigned action = generator() % 8u;
+        if (action < 4u || expected.empty()) {
+            const size_t pos = uniform_int_distribution<size_t>(0u, expected.size())(generator);
+            const auto it = lst.InsertAfter(lst.Advance(lst.cbefore_begin(), pos), step);
+            expected.insert(expected.begin() + pos, step);
+            ASSERT_EQUAL(lst.IndexOf(it), pos);
+        } else if (action < 6u) {
+            const size_t pos = uniform_int_distribution<size_t>(0u, expected.size() - 1u)(generator);
+            const auto next = lst.EraseAfter(pos == 0u ? lst.cbefore_begin() : lst.IteratorAt(pos - 1u));
+            expected.erase(expected.begin() + pos);
+            ASSERT_EQUAL(lst.IndexOf(next), pos);
+        } else if (action == 6u) {
+            lst.PushFront(-step);
+            expected.insert(expected.begin(), -step);
+        } else {
+            lst.PopFront();
+            expected.erase(expected.begin());
+        }
+        check_access();
+    }
+
+    // Устаревший итератор: номер находится проходом по списку
+    const auto stale = lst.IteratorAt(10u);
+    lst.PushFront(1);
+    expected.insert(expected.begin(), 1);
+    lst.EraseAfter(stale);
+    expected.erase(expected.begin() + 12);
+    check_access();
+
+    // Перенос, сортировка и разворот перестраивают индекс при следующем обращении
+    lst.SpliceAfter(lst.IteratorAt(5u), SingleLinkedList<int>{ 100, 200, 300 });
+    expected.insert(expected.begin() + 6, { 100, 200, 300 });
+    check_access();
+    lst.Sort();
+    sort(expected.begin(), expected.end());
+    check_access();
+    lst.Reverse();
+    reverse(expected.begin(), expected.end());
+    check_access();
+    ASSERT(equal(lst.begin(), lst.end(), expected.begin(), expected.end()));
+
+    const IndexedSingleLinkedList<int>& const_lst = lst;
+    ASSERT_EQUAL(const_lst.At(3u), expected[3]);
+    ASSERT_EQUAL(*const_lst.Advance(const_lst.begin(), 5u), expected[5]);
+    bool thrown = false;
+    try {
+        [[maybe_unused]] const int& value = lst.At(expected.size());
+    } catch (const out_of_range&) {
+        thrown = true;
+    }
+    ASSERT(thrown);
+
+    IndexedSingleLinkedList<int> copy(lst);
+    ASSERT(copy == lst);
+    ASSERT_EQUAL(copy.At(expected.size() - 1u), expected.back());
+    lst.Clear();
+    ASSERT(lst.IsEmpty());
+    lst.PushBack(1);
+    ASSERT_EQUAL(lst.At(0u), 1);
+
+    // Без индекса InsertAfter/EraseAfter не ищут номер: итератор, устаревший после изменения списка,
+    // не приводит к проходу от начала, а номер возвращённого итератора находится при обращении к IndexOf
+    {
+        IndexedSingleLinkedList<int> plain{ 1, 2, 3, 4, 5, 6 };
+        for (auto it = plain.begin(); it != plain.end(); ++it) {
+            plain.InsertAfter(it, 0);
+            ++it;
+        }
+        ASSERT((plain.GetList() == SingleLinkedList<int>{ 1, 0, 2, 0, 3, 0, 4, 0, 5, 0, 6, 0 }));
+        for (auto it = plain.begin(); it != plain.end(); ++it) {
+            plain.EraseAfter(it);
+        }
+        ASSERT((plain.GetList() == SingleLinkedList<int>{ 1, 2, 3, 4, 5, 6 }));
+        const auto inserted = plain.InsertAfter(std::next(plain.begin(), 2), 10);
+        ASSERT_EQUAL(plain.IndexOf(inserted), 3u);
+        ASSERT_EQUAL(*plain.Advance(inserted, 2u), 5);
+    }
+    {
+        const auto make_indexed = [](size_t n) { return MakeIotaList<IndexedSingleLinkedList<int>>(n); };
+        const auto erase_every_second = [](IndexedSingleLinkedList<int>& indexed) {
+            for (auto it = indexed.begin(); it != indexed.end() && std::next(it) != indexed.end(); ++it) {
+                indexed.EraseAfter(it);
+            }
+        };
+        ASSERT_COMPLEXITY(Complexity::Linear, 1u << 16, make_indexed, erase_every_second);
+    }
+
+    // Доступ по номеру за O(√n). Список создаётся в куче: при перемещении индекс не переносится
+    // и строился бы заново при первом замеряемом обращении
+    {
+        const auto make_indexed = [](size_t n) {
+            auto indexed = std::make_unique<IndexedSingleLinkedList<int>>();
+            for (size_t i = 0u; i < n; ++i) indexed->PushBack(static_cast<int>(i));
+            [[maybe_unused]] const int& first = indexed->At(0u);
+            return indexed;
+        };
+        size_t checksum = 0u;
+        const auto access = [&checksum](std::unique_ptr<IndexedSingleLinkedList<int>>& indexed) {
+            const size_t size = indexed->GetSize();
+            for (size_t i = 0u; i < 64u; ++i) checksum += static_cast<size_t>(indexed->At(size - 1u - i * size / 64u));
+        };
+        ASSERT_COMPLEXITY(Complexity::SquareRoot, 1u << 16, make_indexed, access);
+        ASSERT(checksum > 0u);
+    }
+
+    // Номер устаревшего итератора при построенном индексе находится проходом не длиннее блока
+    {
+        using Indexed = IndexedSingleLinkedList<int>;
+        struct StaleIterators {
+            std::unique_ptr<Indexed> indexed;
+            vector<Indexed::ConstIterator> positions;
+        };
+        const auto make_stale = [](size_t n) {
+            StaleIterators stale{ std::make_unique<Indexed>(), {} };
+            for (size_t i = 0u; i < n; ++i) stale.indexed->PushBack(static_cast<int>(i));
+            for (size_t i = 0u; i < 64u; ++i) stale.positions.push_back(stale.indexed->IteratorAt(i * n / 64u));
+            stale.indexed->PushFront(-1);
+            return stale;
+        };
+        const auto insert_after_stale = [](StaleIterators& stale) {
+            for (const auto& pos : stale.positions) {
+                const auto inserted = stale.indexed->InsertAfter(pos, 0);
+                ASSERT_EQUAL(*std::next(stale.indexed->IteratorAt(stale.indexed->IndexOf(inserted) - 1u)), 0);
+            }
+        };
+        ASSERT_COMPLEXITY(Complexity::SquareRoot, 1u << 16, make_stale, insert_after_stale);
+
+        StaleIterators stale = make_stale(1000u);
+        for (size_t i = 0u; i < stale.positions.size(); ++i) {
+            ASSERT_EQUAL(stale.indexed->IndexOf(stale.positions[i]), i * 1000u / 64u + 1u);
+        }
+        stale.indexed->PopFront();
+        stale.indexed->EraseAfter(stale.positions[10]);
+        ASSERT_EQUAL(stale.indexed->IndexOf(stale.positions[11]), 11u * 1000u / 64u - 1u);
+    }
+}
+
+// Запуск Unit-тестов для односвязного списка с индексом
+void RunTestIndexedSingleLinkedList() {
+    RUN_TEST(UnitTestIndexedList);
+}
+
+// UNIT-TEST: Проверка списка со встроенным хранилищем в сравнении с std::vector: короткий список
+// не выделяет узлов в куче, длинный выделяет только узлы сверх встроенных, освобождённые встроенные
+// места переиспользуются
+void UnitTestSmallList() {
+    using List = SmallSingleLinkedList<int, 4u>;
+    List lst;
+    vector<int> expected;
+    mt19937 generator(11);
+
+    for (int step = 0; step < 3000; ++step) {
+        const unsigned action = generator() % 6u;
+        const size_t heap_nodes = lst.GetHeapNodeCount();
+        const bool inline_full = lst.GetSize() - heap_nodes == 4u;
+        if (action < 3u || expected.empty()) {
+            const size_t pos = uniform_int_distribution<size_t>(0u, expected.size())(generator);
+            const auto it = lst.InsertAfter(next(lst.cbefore_begin(), static_cast<ptrdiff_t>(pos)), step);
+            expected.insert(expected.begin() + pos, step);
+            ASSERT_EQUAL(*it, step);
+        } else if (action < 5u) {
+            const size_t pos = uniform_int_distribution<size_t>(0u, expected.size() - 1u)(generator);
+            lst.EraseAfter(next(lst.cbefore_begin(), static_cast<ptrdiff_t>(pos)));
+            expected.erase(expected.begin() + pos);
+        } else {
+            lst.PushBack(-step);
+            expected.push_back(-step);
+        }
+        ASSERT_EQUAL(lst.GetSize(), expected.size());
+        // Узел в куче выделяется, только если встроенное хранилище занято
+        if (lst.GetHeapNodeCount() > heap_nodes) ASSERT(inline_full);
+        ASSERT(lst.GetSize() - lst.GetHeapNodeCount() <= 4u);
+        ASSERT(equal(lst.begin(), lst.end(), expected.begin(), expected.end()));
+        if (!expected.empty()) ASSERT_EQUAL(lst.back(), expected.back());
+        // Перемещение туда и обратно сохраняет порядок узлов встроенного хранилища и кучи
+        if (step % 50 == 0) {
+            List moved(std::move(lst));
+            ASSERT(lst.IsEmpty());
+            lst = std::move(moved);
+            ASSERT(equal(lst.begin(), lst.end(), expected.begin(), expected.end()));
+        }
+        if (expected.size() > 12u) {
+            while (expected.size() > 2u) {
+                lst.PopFront();
+                expected.erase(expected.begin());
+            }
+        }
+    }
+
+    // Короткие списки не обращаются к аллокатору
+    CountingAllocator<void>::allocations = 0u;
+    {
+        SmallSingleLinkedList<string, 2u, CountingAllocator<string>> words;
+        words.PushBack("one"s);
+        words.EmplaceFront("zero"s);
+        ASSERT_EQUAL(CountingAllocator<void>::allocations, 0u);
+        words.PushBack("two"s);
+        ASSERT_EQUAL(CountingAllocator<void>::allocations, 1u);
+        ASSERT_EQUAL(words.GetHeapNodeCount(), 1u);
+        words.PopBack();
+        ASSERT_EQUAL(words.GetHeapNodeCount(), 0u);
+        ASSERT_EQUAL(words.front(), "zero"s);
+    }
+
+    // Копирование, перемещение и обмен
+    List first = { 1, 2, 3, 4, 5, 6 };
+    List second = { 7 };
+    ASSERT_EQUAL(first.GetHeapNodeCount(), 2u);
+    first.swap(second);
+    ASSERT_EQUAL(first.GetSize(), 1u);
+    ASSERT_EQUAL(second.GetSize(), 6u);
+    ASSERT_EQUAL(first.GetHeapNodeCount(), 0u);
+    ASSERT(first.before_end() != first.before_begin());
+    first.PushBack(8);
+    ASSERT_EQUAL(first.back(), 8);
+
+    List copy(second);
+    ASSERT(copy == second);
+    List moved(std::move(copy));
+    ASSERT(copy.IsEmpty());
+    ASSERT(copy.before_end() == copy.before_begin());
+    ASSERT(moved == second);
+    copy = moved;
+    ASSERT(copy == moved);
+    swap(copy, first);
+    ASSERT(first < copy);
+    ASSERT(copy > first);
+
+    ostringstream out;
+    out << copy;
+    ASSERT_EQUAL(out.str(), "{7, 8}"s);
+
+    copy.Clear();
+    ASSERT(copy.IsEmpty());
+    ASSERT(copy.begin() == copy.end());
+    copy.PushFront(1);
+    ASSERT_EQUAL(copy.front(), 1);
+
+    // Перемещение и обмен перецепляют узлы в куче без обращения к аллокатору: итераторы на элементы
+    // в куче остаются действительными
+    static_assert(std::is_nothrow_move_constructible_v<List> && std::is_nothrow_swappable_v<List>);
+    {
+        using Words = SmallSingleLinkedList<string, 2u, CountingAllocator<string>>;
+        Words words{ "a"s, "b"s, "c"s, "d"s, "e"s };
+        words.EraseAfter(words.cbefore_begin());
+        words.PushFront("f"s);
+        Words others{ "x"s };
+        const auto heap_element = next(words.begin(), 3);
+        ASSERT_EQUAL(*heap_element, "d"s);
+
+        CountingAllocator<void>::allocations = 0u;
+        Words moved(std::move(words));
+        ASSERT(words.IsEmpty());
+        ASSERT_EQUAL(moved.GetHeapNodeCount(), 3u);
+        moved.swap(others);
+        ASSERT_EQUAL(CountingAllocator<void>::allocations, 0u);
+        ASSERT((moved == Words{ "x"s }));
+        ASSERT((others == Words{ "f"s, "b"s, "c"s, "d"s, "e"s }));
+        ASSERT_EQUAL(*heap_element, "d"s);
+        others.EraseAfter(heap_element);
+        others.PushBack("g"s);
+        ASSERT((others == Words{ "f"s, "b"s, "c"s, "d"s, "g"s }));
+    }
+
+    // Если копирование элемента встроенного хранилища выбрасывает исключение, исходный список не меняется
+    {
+        int copy_counter = 1;
+        SmallSingleLinkedList<ThrowOnCopy, 2u> source;
+        source.PushFront(ThrowOnCopy(copy_counter));
+        source.PushFront(ThrowOnCopy{});
+        source.PushFront(ThrowOnCopy{});
+        copy_counter = 0;
+        try {
+            SmallSingleLinkedList<ThrowOnCopy, 2u> moved(std::move(source));
+            ASSERT_HINT(false, "exception expected"s);
+        } catch (const std::bad_alloc&) {
+        }
+        ASSERT_EQUAL(source.GetSize(), 3u);
+        ASSERT_EQUAL(source.GetHeapNodeCount(), 1u);
+        source.PopFront();
+        ASSERT_EQUAL(source.GetSize(), 2u);
+    }
+
+    // Исключение при создании элемента в освобождённом встроенном месте не портит список свободных мест
+    {
+        SmallSingleLinkedList<ThrowOnCopy, 4u> throwing_list;
+        for (int i = 0; i < 4; ++i) throwing_list.PushFront(ThrowOnCopy{});
+        throwing_list.PopFront();
+        throwing_list.PopFront();
+        int copy_counter = 0;
+        try {
+            const ThrowOnCopy throwing(copy_counter);
+            throwing_list.PushFront(throwing);
+            ASSERT_HINT(false, "exception expected"s);
+        }
+        catch (const std::bad_alloc&) {
+            ASSERT_EQUAL(throwing_list.GetSize(), 2u);
+        }
+        for (int i = 0; i < 3; ++i) throwing_list.PushFront(ThrowOnCopy{});
+        ASSERT_EQUAL(throwing_list.GetSize(), 5u);
+        ASSERT_EQUAL(throwing_list.GetHeapNodeCount(), 1u);
+        size_t steps = 0u;
+        for (auto it = throwing_list.begin(); it != throwing_list.end() && steps <= 5u; ++it) ++steps;
+        ASSERT_EQUAL(steps, 5u);
+    }
+
+    // Добавление в конец списка не зависит от его размера и после заполнения встроенного хранилища
+    const auto push_back = [](List& small) {
+        for (int i = 0; i < 64; ++i) small.PushBack(i);
+    };
+    ASSERT_COMPLEXITY(Complexity::Constant, 1u << 16, MakeIotaList<List>, push_back);
+}
+
+// Запуск Unit-тестов для односвязного списка со встроенным хранилищем
+void RunTestSmallSingleLinkedList() {
+    RUN_TEST(UnitTestSmallList);
+}
+
+// UNIT-TEST: Проверка персистентного списка: копии разделяют узлы и не меняются при изменении друг друга
+void UnitTestPersistentList() {
+    using List = PersistentSingleLinkedList<int>;
+
+    List lst{ 1, 2, 3 };
+    ASSERT_EQUAL(lst.GetSize(), 3u);
+    ASSERT_EQUAL(lst.front(), 1);
+
+    List copy(lst);
+    ASSERT(copy.SharesNodesWith(lst));
+    copy.PushFront(0);
+    copy.EmplaceFront(-1);
+    ASSERT((copy == List{ -1, 0, 1, 2, 3 }));
+    ASSERT((lst == List{ 1, 2, 3 }));
+    ASSERT_EQUAL(&*next(copy.begin(), 2), &lst.front());
+
+    // PopFront и GetTail переходят к общему хвосту, не трогая другие копии
+    List tail = lst.GetTail();
+    ASSERT((tail == List{ 2, 3 }));
+    lst.PopFront();
+    ASSERT(lst.SharesNodesWith(tail));
+    ASSERT((copy == List{ -1, 0, 1, 2, 3 }));
+    lst.Clear();
+    tail.Clear();
+    ASSERT(lst.IsEmpty());
+    ASSERT(lst.begin() == lst.end());
+    ASSERT((copy == List{ -1, 0, 1, 2, 3 }));
+
+    // Присваивание, перемещение, сравнения и вывод
+    lst = copy;
+    ASSERT(lst.SharesNodesWith(copy));
+    List moved(std::move(lst));
+    ASSERT(lst.IsEmpty());
+    ASSERT(moved == copy);
+    lst = std::move(moved);
+    ASSERT(moved.IsEmpty());
+    moved = List{ -1, 0, 1, 2, 4 };
+    ASSERT(lst < moved);
+    ASSERT(moved > copy);
+    ASSERT(lst != moved);
+    swap(lst, moved);
+    ASSERT_EQUAL(lst.front(), -1);
+    ostringstream out;
+    out << moved;
+    ASSERT_EQUAL(out.str(), "{-1, 0, 1, 2, 3}"s);
+
+    // Элементы разрушаются, когда на узел не ссылается ни один список
+    struct CountedDeletion {
+        explicit CountedDeletion(int* counter) noexcept : counter_ptr(counter) { }
+        ~CountedDeletion() { ++(*counter_ptr); }
+
+        int* counter_ptr;
+    };
+    int deletion_counter = 0;
+    {
+        PersistentSingleLinkedList<CountedDeletion> spies;
+        spies.EmplaceFront(&deletion_counter);
+        auto spies_copy = spies;
+        spies.Clear();
+        ASSERT_EQUAL(deletion_counter, 0);
+        spies_copy.PopFront();
+        ASSERT_EQUAL(deletion_counter, 1);
+    }
+
+    // Длинная цепочка освобождается без рекурсии
+    {
+        List long_list;
+        for (int i = 0; i < 1'000'000; ++i) long_list.PushFront(i);
+        List long_copy = long_list;
+        long_list.Clear();
+        ASSERT_EQUAL(long_copy.GetSize(), 1'000'000u);
+    }
+
+    // Копирование и добавление в начало не копируют разделяемые узлы
+    {
+        const auto make_persistent = [](size_t n) {
+            PersistentSingleLinkedList<int> persistent;
+            for (size_t i = 0u; i < n; ++i) persistent.PushFront(static_cast<int>(i));
+            return persistent;
+        };
+        const auto copy_and_push_front = [](PersistentSingleLinkedList<int>& persistent) {
+            for (int i = 0; i < 64; ++i) {
+                PersistentSingleLinkedList<int> copy(persistent);
+                copy.PushFront(i);
+                persistent = copy;
+            }
+        };
+        ASSERT_COMPLEXITY(Complexity::Constant, 1u << 16, make_persistent, copy_and_push_front);
+    }
+}
+
+// UNIT-TEST: Проверка персистентного списка в нескольких потоках: каждый поток копирует общий снимок,
+// добавляет свои элементы и удаляет их, снимок при этом не меняется
+void UnitTestPersistentListThreads() {
+    using List = PersistentSingleLinkedList<int>;
+    List snapshot;
+    for (int i = 0; i < 1000; ++i) snapshot.PushFront(i);
+    const List expected = snapshot;
+
+    vector<thread> readers;
+    vector<int> ok(16, 0);
+    for (int t = 0; t < 16; ++t) {
+        readers.emplace_back([&snapshot, &ok, t] {
+            bool good = true;
+            for (int round = 0; round < 200; ++round) {
+                List own = snapshot;
+                for (int i = 0; i < 8; ++i) own.PushFront(t * 100 + i);
+                good = good && own.GetSize() == 1008u && own.front() == t * 100 + 7;
+                List shared_tail = own;
+                for (int i = 0; i < 8; ++i) shared_tail.PopFront();
+                good = good && shared_tail.SharesNodesWith(snapshot);
+            }
+            ok[t] = good ? 1 : 0;
+        });
+    }
+    for (thread& reader : readers) reader.join();
+
+    ASSERT(all_of(ok.begin(), ok.end(), [](int good) { return good == 1; }));
+    ASSERT(snapshot.SharesNodesWith(expected));
+    ASSERT_EQUAL(snapshot.GetSize(), 1000u);
+    ASSERT_EQUAL(snapshot.front(), 999);
+}
+
+// Запуск Unit-тестов для персистентного односвязного списка
+void RunTestPersistentSingleLinkedList() {
+    RUN_TEST(UnitTestPersistentList);
+    RUN_TEST(UnitTestPersistentListThreads);
+}
+
+// Хеш-функция с частыми совпадениями корзин: длинные цепочки и корзины, делящиеся при удвоении неравномерно
+struct CollidingHash {
+    size_t operator()(int key) const noexcept { return static_cast<size_t>(key) % 37u * 8u; }
+};
+
+// UNIT-TEST: Проверка хеш-таблицы в сравнении с std::unordered_map, в том числе во время переноса корзин
+template <typename Hash>
+void CheckHashMapAgainstUnorderedMap() {
+    HashMap<int, int, Hash> map;
+    unordered_map<int, int> expected;
+    mt19937 generator(5);
+    bool seen_rehashing = false;
+
+    // Проверка содержимого: полный обход и поиск каждого ключа
+    const auto check_contents = [&] {
+        ASSERT_EQUAL(map.GetSize(), expected.size());
+        ASSERT_EQUAL(static_cast<size_t>(distance(map.begin(), map.end())), expected.size());
+        for (const auto& [key, value] : map) {
+            const auto it = expected.find(key);
+            ASSERT(it != expected.end());
+            ASSERT_EQUAL(it->second, value);
+        }
+        for (const auto& [key, value] : expected) {
+            ASSERT_EQUAL(map.At(key), value);
+        }
+    };
+
+    for (int step = 0; step < 20000; ++step) {
+        const int key = uniform_int_distribution<int>(0, 3000)(generator);
+        const unsigned action = generator() % 8u;
+        if (action < 4u) {
+            const auto [it, inserted] = map.Insert({ key, step });
+            const bool expected_inserted = expected.insert({ key, step }).second;
+            ASSERT_EQUAL(inserted, expected_inserted);
+            ASSERT_EQUAL(it->first, key);
+            ASSERT_EQUAL(it->second, expected[key]);
+        } else if (action < 6u) {
+            ASSERT_EQUAL(map.Erase(key), expected.erase(key));
+        } else if (action == 6u) {
+            map[key] += 1;
+            expected[key] += 1;
+        } else {
+            ASSERT_EQUAL(map.Contains(key), expected.count(key) > 0u);
+            const auto it = map.Find(key);
+            ASSERT_EQUAL(it != map.end(), expected.count(key) > 0u);
+        }
+        seen_rehashing = seen_rehashing || map.IsRehashing();
+        ASSERT(map.GetLoadFactor() <= 1.5);
+        if (step % 50 == 0 && (map.IsRehashing() || step % 1000 == 0)) {
+            check_contents();
+        }
+    }
+    check_contents();
+    ASSERT(seen_rehashing);
+
+    // Удаление по итератору во время обхода
+    for (auto it = map.begin(); it != map.end();) {
+        if (it->first % 3 == 0) {
+            expected.erase(it->first);
+            it = map.Erase(it);
+        } else {
+            ++it;
+        }
+    }
+    check_contents();
+}
+
+void UnitTestHashMap() {
+    CheckHashMapAgainstUnorderedMap<std::hash<int>>();
+    CheckHashMapAgainstUnorderedMap<CollidingHash>();
+
+    // Ссылки на элементы остаются действительными при удвоении числа корзин
+    HashMap<string, int> map;
+    map["first"s] = 1;
+    int& first = map.At("first"s);
+    const size_t initial_buckets = map.GetBucketCount();
+    for (int i = 0; i < 1000; ++i) map.Insert({ to_string(i), i });
+    ASSERT(map.GetBucketCount() > initial_buckets);
+    ASSERT_EQUAL(&first, &map.At("first"s));
+    ASSERT_EQUAL(map.TryEmplace("first"s, 5).first->second, 1);
+
+    bool thrown = false;
+    try {
+        [[maybe_unused]] const int& value = map.At("missing"s);
+    } catch (const out_of_range&) {
+        thrown = true;
+    }
+    ASSERT(thrown);
+
+    // Копирование, перемещение, обмен и сравнения
+    HashMap<string, int> copy(map);
+    ASSERT(copy == map);
+    copy["first"s] = 2;
+    ASSERT(copy != map);
+    HashMap<string, int> moved(std::move(copy));
+    ASSERT(copy.IsEmpty());
+    copy["x"s] = 1;
+    ASSERT_EQUAL(copy.GetSize(), 1u);
+    swap(moved, copy);
+    ASSERT_EQUAL(moved.GetSize(), 1u);
+    ASSERT_EQUAL(copy.At("first"s), 2);
+    copy.Erase(copy.Find("first"s));
+    copy["first"s] = 1;
+    ASSERT(copy == map);
+    moved = map;
+    ASSERT(moved == map);
+
+    HashMap<int, int> reserved;
+    reserved.Reserve(5000u);
+    const size_t reserved_buckets = reserved.GetBucketCount();
+    for (int i = 0; i < 5000; ++i) reserved[i] = i;
+    ASSERT_EQUAL(reserved.GetBucketCount(), reserved_buckets);
+    ASSERT(!reserved.IsRehashing());
+
+    reserved.Clear();
+    ASSERT(reserved.IsEmpty());
+    ASSERT(reserved.begin() == reserved.end());
+    ASSERT(!reserved.Contains(1));
+    reserved[1] = 1;
+    ASSERT((reserved == HashMap<int, int>{ { 1, 1 } }));
+
+    // Поиск не зависит от числа элементов. Ищутся одни и те же ключи, чтобы замер не зависел от промахов кеша
+    const auto make_map = [](size_t n) {
+        HashMap<int, int> sized;
+        for (size_t i = 0u; i < n; ++i) sized[static_cast<int>(i)] = static_cast<int>(i);
+        return sized;
+    };
+    size_t found = 0u;
+    const auto find = [&found](HashMap<int, int>& sized) {
+        for (int i = 0; i < 256; ++i) found += sized.Contains(i % 64) ? 1u : 0u;
+    };
+    ASSERT_COMPLEXITY(Complexity::Constant, 1u << 16, make_map, find);
+    ASSERT(found > 0u);
+}
+
+// Запуск Unit-тестов для хеш-таблицы на односвязном списке
+void RunTestHashMap() {
+    RUN_TEST(UnitTestHashMap);
+}
+
+// Подопытный элемент интрузивных списков: крючок-база и крючок-поле для второго списка
+struct IntrusiveItem : IntrusiveListHook<> {
+    explicit IntrusiveItem(int v) : value(v) { }
+
+    int value = 0;
+    IntrusiveListHook<struct SecondListTag> second_hook;
+};
+
+bool operator == (const IntrusiveItem& lhs, const IntrusiveItem& rhs) { return lhs.value == rhs.value; }
+bool operator < (const IntrusiveItem& lhs, const IntrusiveItem& rhs) { return lhs.value < rhs.value; }
+ostream& operator << (ostream& os, const IntrusiveItem& item) { return os << item.value; }
+
+// UNIT-TEST: Проверка интрузивного списка: элементы связываются без копирования, один объект
+// может состоять в двух списках с разными крючками
+void UnitTestIntrusiveList() {
+    using List = IntrusiveSingleLinkedList<IntrusiveItem>;
+    using SecondList = IntrusiveSingleLinkedList<IntrusiveItem,
+        IntrusiveMemberHook<IntrusiveItem, SecondListTag, &IntrusiveItem::second_hook>>;
+
+    vector<IntrusiveItem> items;
+    for (int i = 0; i < 6; ++i) items.emplace_back(i);
+
+    List lst;
+    ASSERT(lst.IsEmpty());
+    ASSERT(lst.begin() == lst.end());
+    ASSERT(++lst.before_begin() == lst.begin());
+
+    for (IntrusiveItem& item : items) lst.PushBack(item);
+    ASSERT_EQUAL(lst.GetSize(), 6u);
+    ASSERT_EQUAL(&lst.front(), &items.front());
+    ASSERT_EQUAL(&lst.back(), &items.back());
+
+    // Второй список - в обратном порядке через крючок-поле
+    SecondList reversed;
+    for (IntrusiveItem& item : items) reversed.PushFront(item);
+    ASSERT_EQUAL(&reversed.front(), &items.back());
+    ASSERT_EQUAL(&*reversed.IteratorTo(items[2]), &items[2]);
+    ASSERT(std::equal(reversed.begin(), reversed.end(), items.rbegin(), items.rend()));
+
+    // Удаление по итератору на элемент и вставка обратно
+    const auto erased_next = lst.EraseAfter(lst.IteratorTo(items[1]));
+    ASSERT_EQUAL(&*erased_next, &items[3]);
+    ASSERT_EQUAL(lst.GetSize(), 5u);
+    ASSERT_EQUAL(reversed.GetSize(), 6u);
+    lst.InsertAfter(lst.cbefore_begin(), items[2]);
+    ASSERT_EQUAL(&lst.front(), &items[2]);
+
+    lst.PopBack();
+    ASSERT_EQUAL(&lst.back(), &items[4]);
+    lst.PushBack(items[5]);
+    lst.PopFront();
+    lst.PushFront(items[2]);
+
+    // Копия объекта не связана ни с одним списком
+    IntrusiveItem copy(items[0]);
+    lst.PushBack(copy);
+    ASSERT_EQUAL(lst.GetSize(), 7u);
+    lst.PopBack();
+
+    // Обмен и перемещение
+    IntrusiveItem extra[] = { IntrusiveItem(0), IntrusiveItem(1), IntrusiveItem(7) };
+    List other;
+    other.PushBack(extra[0]);
+    lst.swap(other);
+    ASSERT_EQUAL(lst.GetSize(), 1u);
+    ASSERT_EQUAL(other.GetSize(), 6u);
+    lst.PushBack(extra[1]);
+    ASSERT_EQUAL(&lst.back(), &extra[1]);
+    ASSERT(lst < other);
+
+    List moved(std::move(other));
+    ASSERT(other.IsEmpty());
+    other.PushBack(extra[2]);
+    ASSERT_EQUAL(moved.GetSize(), 6u);
+    ASSERT_EQUAL(&moved.front(), &items[2]);
+
+    // Сравнения и вывод (элементы со значениями 0, 1, 7, не состоящие в других списках)
+    IntrusiveItem values[] = { IntrusiveItem(0), IntrusiveItem(1), IntrusiveItem(7) };
+    List same;
+    same.PushBack(values[0]);
+    same.PushBack(values[2]);
+    ASSERT(lst != same);
+    ASSERT(lst < same);
+    same.PopBack();
+    same.PushBack(values[1]);
+    ASSERT(lst == same);
+    ASSERT(lst <= same && lst >= same);
+    ostringstream out;
+    out << lst;
+    ASSERT_EQUAL(out.str(), "{0, 1}"s);
+
+    // Список отвязывает элементы до их уничтожения
+    lst.Clear();
+    ASSERT(lst.IsEmpty());
+    ASSERT(lst.before_end() == lst.before_begin());
+}
+
+// Запуск Unit-тестов для интрузивного односвязного списка
+void RunTestIntrusiveSingleLinkedList() {
+    RUN_TEST(UnitTestIntrusiveList);
+}
+
+// UNIT-TEST: Проверка однопоточной работы потокобезопасного списка
+void UnitTestConcurrentBasics() {
+    ConcurrentSingleLinkedList<std::string> lst;
+    ASSERT(lst.IsEmpty());
+    ASSERT(!lst.PopFront().has_value());
+
+    lst.PushFront("c"s);
+    lst.PushFront("a"s);
+    {
+        const auto guard = lst.Pin();
+        ASSERT(lst.InsertAfter(lst.cbegin(), "b"s));
+        ASSERT(lst.InsertAfter(lst.cbefore_begin(), "0"s));
+        ASSERT((std::vector<std::string>(lst.begin(), lst.end()) == std::vector{ "0"s, "a"s, "b"s, "c"s }));
+        ASSERT_EQUAL(lst.GetSize(), 4u);
+
+        ASSERT_EQUAL(lst.EraseAfter(lst.cbegin()).value(), "a"s);
+        ASSERT(!lst.EraseAfter(++(++lst.cbegin())).has_value());
+    }
+
+    ASSERT_EQUAL(lst.PopFront().value(), "0"s);
+    ASSERT_EQUAL(lst.PopFront().value(), "b"s);
+    ASSERT_EQUAL(lst.PopFront().value(), "c"s);
+    ASSERT(lst.IsEmpty());
+    ASSERT_EQUAL(lst.GetSize(), 0u);
+
+    // Вставка после удалённого элемента не выполняется
+    lst.PushFront("x"s);
+    const auto guard = lst.Pin();
+    const auto removed = lst.cbegin();
+    ASSERT(lst.PopFront().has_value());
+    ASSERT(!lst.InsertAfter(removed, "y"s));
+    ASSERT(lst.IsEmpty());
+}
+
+// UNIT-TEST: Нагрузочная проверка потокобезопасного списка: каждый добавленный элемент удаляется ровно один раз
+void UnitTestConcurrentStress() {
+    constexpr int kThreads = 8;
+    constexpr int kItemsPerThread = 20000;
+
+    ConcurrentSingleLinkedList<int> lst;
+    std::vector<std::vector<int>> popped(kThreads);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&lst, &popped, t] {
+            for (int i = 0; i < kItemsPerThread; ++i) {
+                const int value = t * kItemsPerThread + i;
+                if (i % 3 == 0) {
+                    lst.PushFront(value);
+                } else {
+                    // Вставка после первого элемента и удаление после фиктивного узла
+                    const auto guard = lst.Pin();
+                    if (!lst.InsertAfter(lst.cbegin() == lst.cend() ? lst.cbefore_begin() : lst.cbegin(), value)) {
+                        lst.PushFront(value);
+                    }
+                }
+                if (i % 2 == 1) {
+                    if (auto item = (i % 4 == 1) ? lst.PopFront() : lst.EraseAfter(lst.cbefore_begin())) {
+                        popped[t].push_back(*item);
+                    }
+                }
+                if (i % 1000 == 0) {
+                    // Обход списка во время изменений другими потоками
+                    const auto guard = lst.Pin();
+                    long long sum = 0;
+                    for (int item : lst) sum += item;
+                    ASSERT(sum >= 0);
+                }
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    std::vector<int> seen(kThreads * kItemsPerThread, 0);
+    for (const auto& items : popped) {
+        for (int item : items) ++seen[item];
+    }
+    size_t remaining = 0u;
+    while (auto item = lst.PopFront()) {
+        ++seen[*item];
+        ++remaining;
+    }
+    ASSERT(std::all_of(seen.begin(), seen.end(), [](int count) { return count == 1; }));
+    ASSERT(remaining > 0u);
+    ASSERT_EQUAL(lst.GetSize(), 0u);
+}
+
+// UNIT-TEST: Проверка очереди MpscQueue в одном потоке
+void UnitTestMpscQueueBasics() {
+    {
+        MpscQueue<string> queue;
+        ASSERT(queue.IsEmpty());
+        ASSERT(queue.Drain().IsEmpty());
+
+        queue.Push("first element with heap storage"s);
+        queue.Emplace(3u, 'x');
+        ASSERT(!queue.IsEmpty());
+
+        SingleLinkedList<string> batch = queue.Drain();
+        ASSERT((batch == SingleLinkedList<string>{ "first element with heap storage"s, "xxx"s }));
+        ASSERT(queue.IsEmpty());
+
+        // Добавление в конец существующего списка; остаток очереди разрушает деструктор
+        queue.Push("a"s);
+        queue.Push("b"s);
+        queue.DrainInto(batch);
+        ASSERT_EQUAL(batch.GetSize(), 4u);
+        ASSERT_EQUAL(batch.back(), "b"s);
+        batch.PushBack("c"s);
+        ASSERT_EQUAL(batch.GetSize(), 5u);
+        queue.Push("left in queue"s);
+    }
+
+    // Ограниченная очередь
+    {
+        MpscQueue<int> queue(2u);
+        ASSERT_EQUAL(queue.GetCapacity(), 2u);
+        ASSERT(queue.TryPush(1));
+        ASSERT(queue.TryPush(2));
+        ASSERT(!queue.TryPush(3));
+        ASSERT((queue.Drain() == SingleLinkedList<int>{ 1, 2 }));
+        ASSERT(queue.TryPush(3));
+    }
+
+    // Исключение при создании элемента освобождает зарезервированное место: ёмкость не уменьшается,
+    // и Push в ограниченную очередь после неудачных попыток не ждёт бесконечно
+    {
+        MpscQueue<ThrowOnCopy> queue(1u);
+        int countdown = 0;
+        const ThrowOnCopy throwing(countdown);
+        for (int attempt = 0; attempt < 3; ++attempt) {
+            bool thrown = false;
+            try {
+                queue.Push(throwing);
+            } catch (const std::bad_alloc&) {
+                thrown = true;
+            }
+            ASSERT(thrown);
+        }
+        ASSERT(queue.IsEmpty());
+        queue.Push(ThrowOnCopy());
+        ASSERT(!queue.TryPush(ThrowOnCopy()));
+        ASSERT_EQUAL(queue.Drain().GetSize(), 1u);
+    }
+}
+
+// UNIT-TEST: Проверка очереди MpscQueue с несколькими производителями: все элементы доставлены
+// ровно один раз, порядок элементов каждого производителя сохраняется, граница очереди соблюдается
+void UnitTestMpscQueueStress() {
+    constexpr int kProducers = 4;
+    constexpr int kPerProducer = 20000;
+    constexpr size_t kCapacity = 64u;
+    MpscQueue<pair<int, int>> queue(kCapacity);
+
+    vector<thread> producers;
+    for (int p = 0; p < kProducers; ++p) {
+        producers.emplace_back([&queue, p] {
+            for (int i = 0; i < kPerProducer; ++i) {
+                queue.Push({ p, i });
+            }
+        });
+    }
+
+    vector<int> next_expected(kProducers, 0);
+    int received = 0;
+    bool ordered = true;
+    size_t max_batch = 0u;
+    while (received < kProducers * kPerProducer) {
+        const SingleLinkedList<pair<int, int>> batch = queue.Drain();
+        max_batch = max(max_batch, batch.GetSize());
+        for (const auto& [producer, index] : batch) {
+            ordered = ordered && index == next_expected[producer]++;
+            ++received;
+        }
+        if (batch.IsEmpty()) this_thread::yield();
+    }
+    for (thread& producer : producers) {
+        producer.join();
+    }
+
+    ASSERT(ordered);
+    ASSERT(queue.IsEmpty());
+    ASSERT(max_batch <= kCapacity);
+    ASSERT(all_of(next_expected.begin(), next_expected.end(), [](int n) { return n == kPerProducer; }));
+}
+
+// Запуск Unit-тестов для потокобезопасного односвязного списка
+void RunTestConcurrentSingleLinkedList() {
+    RUN_TEST(UnitTestConcurrentBasics);
+    RUN_TEST(UnitTestConcurrentStress);
+    RUN_TEST(UnitTestMpscQueueBasics);
+    RUN_TEST(UnitTestMpscQueueStress);
+}
+
+// Функция получения пути к временному файлу теста
+std::string GetTempFilePath(const std::string& name) {
+    return (std::filesystem::temp_directory_path() / ("sll-"s + std::to_string(getpid()) + "-"s + name)).string();
+}
+
+// UNIT-TEST: Проверка основного интерфейса списка в файле и повторного открытия файла
+void UnitTestMappedBasics() {
+    const std::string path = GetTempFilePath("mapped-basics"s);
+    std::remove(path.c_str());
+
+    {
+        MappedSingleLinkedList<int> lst(path);
+        ASSERT(lst.IsEmpty());
+        ASSERT(lst.begin() == lst.end());
+        ASSERT(++lst.before_begin() == lst.begin());
+
+        lst.PushBack(2);
+        lst.PushFront(1);
+        lst.InsertAfter(lst.cbefore_end(), 4);
+        lst.InsertAfter(++lst.cbegin(), 3);
+        ASSERT_EQUAL(lst.GetSize(), 4u);
+        ASSERT((std::vector<int>(lst.begin(), lst.end()) == std::vector<int>{ 1, 2, 3, 4 }));
+        ASSERT_EQUAL(lst.back(), 4);
+
+        // Рост файла: итераторы остаются действительными, элемент самого списка можно добавить в него
+        const auto first = lst.cbegin();
+        for (int i = 5; i <= 1000; ++i) {
+            lst.PushBack(lst.back() + 1);
+        }
+        ASSERT_EQUAL(*first, 1);
+        ASSERT_EQUAL(lst.GetSize(), 1000u);
+
+        const auto next = lst.EraseAfter(lst.cbefore_begin());
+        ASSERT_EQUAL(*next, 2);
+        lst.EraseAfter(lst.cbegin());
+        lst.PopFront();
+        ASSERT_EQUAL(lst.front(), 4);
+        ASSERT_EQUAL(lst.GetSize(), 997u);
+    }
+
+    // После повторного открытия список сразу готов к обходу; освобождённые узлы используются снова
+    {
+        MappedSingleLinkedList<int> lst(path);
+        ASSERT(!lst.WasRecovered());
+        ASSERT_EQUAL(lst.GetSize(), 997u);
+        ASSERT_EQUAL(lst.front(), 4);
+        ASSERT_EQUAL(lst.back(), 1000);
+        ASSERT(std::is_sorted(lst.begin(), lst.end()));
+
+        const auto file_size = std::filesystem::file_size(path);
+        lst.PushFront(3);
+        lst.PushFront(2);
+        lst.PushFront(1);
+        ASSERT_EQUAL(std::filesystem::file_size(path), file_size);
+
+        lst.Clear();
+        ASSERT(lst.IsEmpty());
+        lst.PushBack(7);
+        lst.Sync();
+    }
+    {
+        MappedSingleLinkedList<int> lst(path);
+        ASSERT((std::vector<int>(lst.begin(), lst.end()) == std::vector<int>{ 7 }));
+
+        // Файл списка с другим типом элементов не открывается
+        bool thrown = false;
+        try {
+            MappedSingleLinkedList<double> wrong_type(path);
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        ASSERT(thrown);
+    }
+
+    std::remove(path.c_str());
+}
+
+// Политика точек отказа для UnitTestMappedCrashConsistency: процесс убивает себя, когда точка отказа
+// point пройдена countdown раз (countdown == 0 - отказов нет)
+struct CrashAtFaultPoint {
+    inline static MappedListFaultPoint point = MappedListFaultPoint::InsertNew;
+    inline static size_t countdown = 0u;
+
+    static void OnFaultPoint(MappedListFaultPoint reached) noexcept {
+        if (countdown != 0u && reached == point && --countdown == 0u) {
+            kill(getpid(), SIGKILL);
+        }
+    }
+};
+
+// UNIT-TEST: Проверка согласованности файла после аварийного завершения процесса в каждой точке отказа:
+// при создании файла, при росте файла, посреди добавления нового и повторно используемого узла и удаления
+void UnitTestMappedCrashConsistency() {
+    using CrashingList = MappedSingleLinkedList<uint64_t, CrashAtFaultPoint>;
+    const std::string path = GetTempFilePath("mapped-crash"s);
+    std::remove(path.c_str());
+    {
+        MappedSingleLinkedList<uint64_t> lst(path);
+    }
+
+    // Аварийное завершение при создании: файла ещё нет, следующее открытие создаёт пустой список
+    {
+        const std::string created_path = GetTempFilePath("mapped-crash-create"s);
+        std::remove(created_path.c_str());
+        const pid_t child = fork();
+        ASSERT(child >= 0);
+        if (child == 0) {
+            CrashAtFaultPoint::point = MappedListFaultPoint::Create;
+            CrashAtFaultPoint::countdown = 1u;
+            CrashingList lst(created_path);
+            _exit(1);
+        }
+        int status = 0;
+        waitpid(child, &status, 0);
+        ASSERT(WIFSIGNALED(status) && WTERMSIG(status) == SIGKILL);
+        {
+            MappedSingleLinkedList<uint64_t> lst(created_path);
+            ASSERT(lst.IsEmpty());
+            lst.PushBack(7u);
+        }
+        MappedSingleLinkedList<uint64_t> reopened(created_path);
+        ASSERT((std::vector<uint64_t>(reopened.begin(), reopened.end()) == std::vector<uint64_t>{ 7u }));
+        std::remove(created_path.c_str());
+        std::remove((created_path + ".tmp"s).c_str());
+    }
+
+    const MappedListFaultPoint points[] = { MappedListFaultPoint::Grow, MappedListFaultPoint::InsertNew,
+                                            MappedListFaultPoint::InsertReused, MappedListFaultPoint::Erase };
+    std::mt19937 generator(42);
+    for (uint64_t round = 1u; round <= 20u; ++round) {
+        // Дочерний процесс меняет список и убивает себя в выбранной точке отказа, пройдя её случайное
+        // число раз. Для роста файла и новых узлов список только растёт. Каждое значение добавляется один раз
+        const MappedListFaultPoint point = points[round % std::size(points)];
+        const bool only_grow = point == MappedListFaultPoint::Grow || point == MappedListFaultPoint::InsertNew;
+        const size_t countdown = point == MappedListFaultPoint::Grow ? 1u : 1u + generator() % 200u;
+        const pid_t child = fork();
+        ASSERT(child >= 0);
+        if (child == 0) {
+            CrashAtFaultPoint::point = point;
+            CrashAtFaultPoint::countdown = countdown;
+            CrashingList lst(path);
+            std::mt19937 child_generator(static_cast<unsigned>(round));
+            for (uint64_t i = 0u; i < 1000000u; ++i) {
+                const uint64_t value = (round << 32) | i;
+                const unsigned op = child_generator() % 4u;
+                if (only_grow || lst.GetSize() < 16u || op == 0u) {
+                    lst.PushBack(value);
+                } else if (op == 1u) {
+                    lst.InsertAfter(lst.cbegin(), value);
+                } else if (op == 2u) {
+                    lst.PopFront();
+                } else {
+                    lst.EraseAfter(lst.cbegin());
+                }
+            }
+            _exit(1);
+        }
+        int status = 0;
+        waitpid(child, &status, 0);
+        ASSERT(WIFSIGNALED(status) && WTERMSIG(status) == SIGKILL);
+
+        // Рост файла происходит до начала операции: служебные поля остаются надёжными
+        MappedSingleLinkedList<uint64_t> lst(path);
+        ASSERT_EQUAL(lst.WasRecovered(), point != MappedListFaultPoint::Grow);
+
+        // Размер и последний элемент согласованы со связями, значения не повторяются
+        std::vector<uint64_t> values(lst.begin(), lst.end());
+        ASSERT_EQUAL(values.size(), lst.GetSize());
+        if (!values.empty()) {
+            ASSERT_EQUAL(lst.back(), values.back());
+        }
+        std::vector<uint64_t> sorted = values;
+        std::sort(sorted.begin(), sorted.end());
+        ASSERT(std::adjacent_find(sorted.begin(), sorted.end()) == sorted.end());
+
+        // Свободные узлы не пересекаются с узлами списка: новые элементы не портят старые
+        for (uint64_t i = 0u; i < 100u; ++i) {
+            lst.PushFront(~i);
+        }
+        auto it = lst.cbegin();
+        std::advance(it, 100);
+        ASSERT(std::equal(it, lst.cend(), values.begin(), values.end()));
+        for (int i = 0; i < 100; ++i) {
+            lst.PopFront();
+        }
+    }
+
+    std::remove(path.c_str());
+}
+
+// Запуск Unit-тестов для односвязного списка в отображённом в память файле
+void RunTestMappedSingleLinkedList() {
+    RUN_TEST(UnitTestMappedBasics);
+    RUN_TEST(UnitTestMappedCrashConsistency);
 }
 
 }
\ No newline at end of file
@@ -6,4 +6,31 @@ namespace unit_tests {
 // Запуск Unit-тестов для односвязного списка
 void RunTestSingleLinkedList();
 
+// Запуск Unit-тестов для развёрнутого односвязного списка
+void RunTestUnrolledSingleLinkedList();
+
+// Запуск Unit-тестов для компактного односвязного списка
+void RunTestCompactSingleLinkedList();
+
+// Запуск Unit-тестов для односвязного списка с индексом
+void RunTestIndexedSingleLinkedList();
+
+// Запуск Unit-тестов для односвязного списка со встроенным хранилищем
+void RunTestSmallSingleLinkedList();
+
+// Запуск Unit-тестов для персистентного односвязного списка
+void RunTestPersistentSingleLinkedList();
+
+// Запуск Unit-тестов для хеш-таблицы на односвязном списке
+void RunTestHashMap();
+
+// Запуск Unit-тестов для интрузивного односвязного списка
+void RunTestIntrusiveSingleLinkedList();
+
+// Запуск Unit-тестов для потокобезопасного односвязного списка
+void RunTestConcurrentSingleLinkedList();
+
+// Запуск Unit-тестов для односвязного списка в отображённом в память файле
+void RunTestMappedSingleLinkedList();
+
 }
\ No newline at end of file
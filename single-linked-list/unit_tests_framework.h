@@ -1,6 +1,17 @@
 #pragma once
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <ctime>
+#include <iomanip>
 #include <iostream>
 #include <string>
+#include <vector>
+
+#include "heap-allocation-counter.h"
 
 // Пространство имён для Unit-тестов
 namespace unit_tests {
@@ -93,12 +104,166 @@ inline void AssertEqualEpsImpl(const double eps, const double& t, const double&
 // Макрос сравнения выражений со значениями действительных чисел (с точностью до epsilon) со строковой подсказкой
 #define ASSERT_EQUAL_EPS_HINT(a, b, eps, hint) AssertEqualEpsImpl((eps), (a), (b), #a, #b, __FILE__, __FUNCTION__, __LINE__, (hint))
 
-// Функция запуска unit-теста для макроса запуска unit-теста
+// Классы сложности для макроса проверки асимптотики операции
+enum class Complexity {
+    Constant,       // O(1)
+    Logarithmic,    // O(log n)
+    SquareRoot,     // O(√n)
+    Linear,         // O(n)
+    Linearithmic,   // O(n log n)
+    Quadratic,      // O(n^2)
+};
+
+// Функция получения записи класса сложности
+inline std::string ComplexityName(Complexity complexity) {
+    using namespace std;
+    switch (complexity) {
+    case Complexity::Constant:     return "O(1)"s;
+    case Complexity::Logarithmic:  return "O(log n)"s;
+    case Complexity::SquareRoot:   return "O(sqrt n)"s;
+    case Complexity::Linear:       return "O(n)"s;
+    case Complexity::Linearithmic: return "O(n log n)"s;
+    case Complexity::Quadratic:    return "O(n^2)"s;
+    }
+    return "O(?)"s;
+}
+
+// Функция, задающая класс сложности, в точке n (логарифм не меньше 1, чтобы не делить на ноль)
+inline double ComplexityBound(Complexity complexity, double n) {
+    const double log_n = std::max(std::log2(n), 1.0);
+    switch (complexity) {
+    case Complexity::Constant:     return 1.0;
+    case Complexity::Logarithmic:  return log_n;
+    case Complexity::SquareRoot:   return std::sqrt(n);
+    case Complexity::Linear:       return n;
+    case Complexity::Linearithmic: return n * log_n;
+    case Complexity::Quadratic:    return n * n;
+    }
+    return n;
+}
+
+// Функция оценки наклона зависимости y от x по точкам (x, y): медиана наклонов всех пар точек (оценка
+// Тейла-Сена). В отличие от метода наименьших квадратов, скачок на одном участке (например, когда данные
+// перестают помещаться в кеш) почти не меняет оценку, а изменение наклона на всех участках меняет
+inline double FitSlope(const std::vector<double>& x, const std::vector<double>& y) {
+    std::vector<double> slopes;
+    slopes.reserve(x.size() * (x.size() - 1u) / 2u);
+    for (size_t i = 0u; i < x.size(); ++i) {
+        for (size_t j = i + 1u; j < x.size(); ++j) {
+            slopes.push_back((y[j] - y[i]) / (x[j] - x[i]));
+        }
+    }
+    const size_t middle = slopes.size() / 2u;
+    std::nth_element(slopes.begin(), slopes.begin() + static_cast<std::ptrdiff_t>(middle), slopes.end());
+    const double upper = slopes[middle];
+    if (slopes.size() % 2u != 0u) {
+        return upper;
+    }
+    return (*std::max_element(slopes.begin(), slopes.begin() + static_cast<std::ptrdiff_t>(middle)) + upper) / 2.0;
+}
+
+// Функция получения времени процессора, затраченного текущим потоком (в наносекундах). Время процессора,
+// в отличие от времени по часам, не растёт, когда поток вытесняют другие процессы: на загруженной машине
+// долгие замеры на больших размерах иначе прерывались бы чаще коротких. Без POSIX - время по часам
+inline double ThreadCpuTimeNs() {
+#if defined(CLOCK_THREAD_CPUTIME_ID)
+    timespec ts{};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return static_cast<double>(ts.tv_sec) * 1e9 + static_cast<double>(ts.tv_nsec);
+#else
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+// Функция проверки асимптотики для макроса проверки асимптотики операции.
+// prepare(n) строит состояние размера n (не замеряется), operation(state) выполняет замеряемую операцию.
+// Время процессора (ThreadCpuTimeNs) берётся минимальным из нескольких запусков на kSizeCount размерах
+// от max_size / 256 до max_size (каждый следующий вдвое больше). По точкам (log n, log t) оценивается
+// показатель роста времени (FitSlope) и сравнивается с показателем роста границы на тех же размерах.
+// Превышение допускается до kExponentTolerance = 1/2: этого хватает на промахи кеша и накладные расходы
+// санитайзеров на больших размерах, но не на классы, отличающиеся в n раз (O(1) и O(n), O(n) и O(n^2)).
+// Замеры короче микросекунды считаются равными микросекунде, поэтому быстрые операции лучше выполнять пачкой
+template <typename Prepare, typename Operation>
+void AssertComplexityImpl(Complexity complexity, size_t max_size, Prepare prepare, Operation operation, const std::string& complexity_str, const std::string& operation_str, const std::string& file, const std::string& func, unsigned line, const std::string& hint) {
+    using namespace std;
+    constexpr size_t kSizeCount = 9u;
+    constexpr size_t kSizeStep = 2u;
+    constexpr int kTrials = 5;
+    constexpr double kTimerFloorNs = 1000.0;
+    constexpr double kExponentTolerance = 0.5;
+
+    const auto measure = [&](size_t n) {
+        double best_ns = HUGE_VAL;
+        for (int trial = 0; trial < kTrials; ++trial) {
+            auto state = prepare(n);
+            const double start_ns = ThreadCpuTimeNs();
+            operation(state);
+            best_ns = min(best_ns, ThreadCpuTimeNs() - start_ns);
+        }
+        return max(best_ns, kTimerFloorNs);
+    };
+
+    vector<size_t> sizes;
+    for (size_t n = max_size, i = 0u; i < kSizeCount && n > 0u; n /= kSizeStep, ++i) {
+        sizes.insert(sizes.begin(), n);
+    }
+    assert(sizes.size() >= 3u);
+
+    vector<double> log_n, log_time, log_bound;
+    vector<double> times;
+    for (size_t n : sizes) {
+        const double time_ns = measure(n);
+        times.push_back(time_ns);
+        log_n.push_back(log(static_cast<double>(n)));
+        log_time.push_back(log(time_ns));
+        log_bound.push_back(log(ComplexityBound(complexity, static_cast<double>(n))));
+    }
+    const double exponent = FitSlope(log_n, log_time);
+    const double bound_exponent = FitSlope(log_n, log_bound);
+    if (exponent > bound_exponent + kExponentTolerance) {
+        cerr << file << "("s << line << "): "s << func << ": "s;
+        cerr << "ASSERT_COMPLEXITY("s << complexity_str << ", "s << operation_str << ") failed: "s;
+        cerr << "time grows as n^"s << exponent << ", "s << ComplexityName(complexity) << " allows n^"s
+             << bound_exponent + kExponentTolerance << " ("s;
+        for (size_t i = 0u; i < sizes.size(); ++i) {
+            cerr << (i > 0u ? ", "s : ""s) << "n = "s << sizes[i] << ": "s << times[i] << " ns"s;
+        }
+        cerr << ")."s;
+        if (!hint.empty()) {
+            cerr << " Hint: "s << hint;
+        }
+        cerr << endl;
+        abort();
+    }
+}
+
+// Макрос проверки асимптотики операции (prepare и operation лучше передавать именованными лямбдами:
+// запятые в теле лямбды разделили бы аргументы макроса)
+#define ASSERT_COMPLEXITY(complexity, max_size, prepare, operation) AssertComplexityImpl((complexity), (max_size), (prepare), (operation), #complexity, #operation, __FILE__, __FUNCTION__, __LINE__, ""s)
+
+// Макрос проверки асимптотики операции со строковой подсказкой
+#define ASSERT_COMPLEXITY_HINT(complexity, max_size, prepare, operation, hint) AssertComplexityImpl((complexity), (max_size), (prepare), (operation), #complexity, #operation, __FILE__, __FUNCTION__, __LINE__, (hint))
+
+// Функция запуска unit-теста для макроса запуска unit-теста.
+// Кроме результата выводит время выполнения теста и число и объём выделений памяти в куче за время теста
 template <typename TestFunction>
 void RunTestImpl(TestFunction test_function, const std::string& test_function_name) {
     using namespace std;
+    const size_t allocations_before = heap_allocation_counter::GetAllocationCount();
+    const size_t bytes_before = heap_allocation_counter::GetAllocatedBytes();
+    const auto start = chrono::steady_clock::now();
     test_function();
-    cerr << test_function_name << " OK"s << endl;
+    const chrono::duration<double, milli> elapsed = chrono::steady_clock::now() - start;
+    const size_t allocations = heap_allocation_counter::GetAllocationCount() - allocations_before;
+    const size_t bytes = heap_allocation_counter::GetAllocatedBytes() - bytes_before;
+
+    const auto flags = cerr.flags();
+    const auto precision = cerr.precision();
+    cerr << test_function_name << " OK"s;
+    cerr << fixed << setprecision(2) << " ("s << elapsed.count() << " ms, "s;
+    cerr << allocations << " allocations, "s << bytes << " bytes)"s << endl;
+    cerr.flags(flags);
+    cerr.precision(precision);
 }
 
 // Макрос запуска unit-теста
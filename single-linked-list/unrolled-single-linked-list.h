@@ -0,0 +1,456 @@
+#pragma once
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// Класс развёрнутого односвязного списка: каждый узел хранит до N элементов в массиве, поэтому обход
+// списка читает память подряд и реже промахивается мимо кэша. Интерфейс повторяет SingleLinkedList.
+// В отличие от SingleLinkedList, InsertAfter/EraseAfter могут сдвигать элементы внутри узла, поэтому
+// они делают недействительными итераторы на элементы изменённых узлов
+template <typename Type, size_t N = 16u>
+class UnrolledSingleLinkedList {
+    static_assert(N > 0u, "Node capacity must be positive");
+    static_assert(std::is_nothrow_move_constructible_v<Type>, "Elements are moved inside nodes and must not throw on move");
+
+private:
+    // Базовая структура узла списка: связь со следующим узлом и количество элементов (у фиктивного узла - 0)
+    struct NodeBase {
+        NodeBase* next_node = nullptr;
+        size_t count = 0u;
+    };
+
+    // Структура узла списка: массив из N мест под элементы, занятыми являются первые count мест
+    struct Node : NodeBase {
+        explicit Node(NodeBase* next) noexcept : NodeBase{ next, 0u } { }
+
+        Node(const Node&) = delete;
+        Node& operator = (const Node&) = delete;
+
+        ~Node() noexcept {
+            for (size_t i = 0u; i < this->count; ++i) {
+                At(i).~Type();
+            }
+        }
+
+        Type& At(size_t index) noexcept {
+            return *std::launder(reinterpret_cast<Type*>(storage + index * sizeof(Type)));
+        }
+
+        // Перемещение элемента из одного места в другое свободное место (возможно, другого узла)
+        void MoveTo(size_t from, Node& dst, size_t to) noexcept {
+            Type& value = At(from);
+            ::new (dst.storage + to * sizeof(Type)) Type(std::move(value));
+            value.~Type();
+        }
+
+        // Вставка элемента в позицию index со сдвигом последующих элементов вправо
+        void Insert(size_t index, Type&& value) noexcept {
+            assert(this->count < N);
+            assert(index <= this->count);
+
+            for (size_t i = this->count; i > index; --i) {
+                MoveTo(i - 1u, *this, i);
+            }
+            ::new (storage + index * sizeof(Type)) Type(std::move(value));
+            ++this->count;
+        }
+
+        // Удаление элемента в позиции index со сдвигом последующих элементов влево
+        void Erase(size_t index) noexcept {
+            assert(index < this->count);
+
+            At(index).~Type();
+            for (size_t i = index + 1u; i < this->count; ++i) {
+                MoveTo(i, *this, i - 1u);
+            }
+            --this->count;
+        }
+
+        alignas(Type) std::byte storage[N * sizeof(Type)];
+    };
+
+    // Класс итератора/константного итератора (ValueType=Type/const Type) списка
+    template <typename ValueType>
+    class BasicIterator {
+        // Предоставим классу списка доступ к приватным полям и методам
+        friend class UnrolledSingleLinkedList;
+
+    public:
+        // Описание типа итератора
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = ValueType*;
+        using reference = ValueType&;
+
+        // Конструктор по умолчанию
+        BasicIterator() = default;
+
+        // Конструктор копирования
+        BasicIterator(const BasicIterator<Type>& other) noexcept : node_(other.node_), index_(other.index_) { }
+
+        // Оператор присваивания
+        BasicIterator& operator = (const BasicIterator& rhs) = default;
+
+        // Операторы сравнения неконстантных итераторов (ValueType = Type)
+        [[nodiscard]] bool operator == (const BasicIterator<Type>& rhs) const noexcept { return node_ == rhs.node_ && index_ == rhs.index_; }
+        [[nodiscard]] bool operator != (const BasicIterator<Type>& rhs) const noexcept { return !(*this == rhs); }
+
+        // Операторы сравнения константных итераторов (ValueType = const Type)
+        [[nodiscard]] bool operator == (const BasicIterator<const Type>& rhs) const noexcept { return node_ == rhs.node_ && index_ == rhs.index_; }
+        [[nodiscard]] bool operator != (const BasicIterator<const Type>& rhs) const noexcept { return !(*this == rhs); }
+
+        // Преинкремент: следующий элемент того же узла или первый элемент следующего узла
+        BasicIterator& operator ++ () noexcept {
+            assert(node_);
+            if (++index_ >= node_->count) {
+                node_ = node_->next_node;
+                index_ = 0u;
+            }
+            return *this;
+        }
+
+        // Постинкремент
+        BasicIterator operator ++ (int) noexcept {
+            BasicIterator tmp(*this);
+            ++(*this);
+            return tmp;
+        }
+
+        // Оператор разыменовывания
+        [[nodiscard]] reference operator * () const noexcept {
+            assert(node_ && index_ < node_->count);
+            return static_cast<Node*>(node_)->At(index_);
+        }
+
+        // Оператор доступа к членам
+        [[nodiscard]] pointer operator -> () const noexcept {
+            return &(**this);
+        }
+
+    private:
+        NodeBase* node_ = nullptr; // Указатель на узел
+        size_t index_ = 0u;        // Индекс элемента в узле
+
+        // Конструктор, создающий итератор из указателя на узел и индекса элемента (используется в классе списка)
+        BasicIterator(NodeBase* node, size_t index) noexcept : node_(node), index_(index) { }
+    };
+
+public:
+    // Псевдонимы для типов, ссылок, константных ссылок, итераторов и константных итераторов
+    using value_type = Type;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+    using Iterator      = BasicIterator<Type>;
+    using ConstIterator = BasicIterator<const Type>;
+
+    // Ёмкость одного узла
+    static constexpr size_t node_capacity = N;
+
+    // Конструктор по умолчанию создаёт пустой список
+    UnrolledSingleLinkedList() noexcept = default;
+
+    // Конструктор, создающий список из элементов std::initializer_list
+    UnrolledSingleLinkedList(std::initializer_list<Type> values) {
+        CopyAndSwapFromIteratorRage(values.begin(), values.end());
+    }
+
+    // Конструктор копирования
+    UnrolledSingleLinkedList(const UnrolledSingleLinkedList& other) {
+        CopyAndSwapFromIteratorRage(other.begin(), other.end());
+    }
+
+    // Конструктор перемещения
+    UnrolledSingleLinkedList(UnrolledSingleLinkedList&& other) noexcept { swap(other); }
+
+    // Деструктор
+    ~UnrolledSingleLinkedList() noexcept { Clear(); }
+
+    // Оператор присваивания
+    UnrolledSingleLinkedList& operator = (const UnrolledSingleLinkedList& rhs) {
+        if (this != &rhs) {
+            UnrolledSingleLinkedList rhs_copy(rhs);
+            this->swap(rhs_copy);
+        }
+        return *this;
+    }
+
+    // Оператор перемещающего присваивания
+    UnrolledSingleLinkedList& operator = (UnrolledSingleLinkedList&& rhs) noexcept {
+        if (this != &rhs) {
+            Clear();
+            swap(rhs);
+        }
+        return *this;
+    }
+
+    // Итераторы, указывающие на начало, конец и фиктивный узел списка
+    [[nodiscard]] Iterator begin()        noexcept { return Iterator(head_.next_node, 0u); }
+    [[nodiscard]] Iterator end()          noexcept { return Iterator(nullptr, 0u); }
+    [[nodiscard]] Iterator before_begin() noexcept { return Iterator(&head_, 0u); }
+
+    // Итератор, указывающий на последний элемент списка (на фиктивный узел, если список пуст)
+    [[nodiscard]] Iterator before_end() noexcept {
+        return tail_ == &head_ ? before_begin() : Iterator(tail_, tail_->count - 1u);
+    }
+
+    // Константные итераторы, указывающие на начало, конец и фиктивный узел списка
+    [[nodiscard]] ConstIterator begin()        const noexcept { return cbegin(); }
+    [[nodiscard]] ConstIterator end()          const noexcept { return cend(); }
+    [[nodiscard]] ConstIterator before_begin() const noexcept { return cbefore_begin(); }
+
+    [[nodiscard]] ConstIterator cbegin()        const noexcept { return Iterator(head_.next_node, 0u); }
+    [[nodiscard]] ConstIterator cend()          const noexcept { return Iterator(nullptr, 0u); }
+    [[nodiscard]] ConstIterator cbefore_begin() const noexcept { return Iterator(const_cast<NodeBase*>(&head_), 0u); }
+
+    // Функция обмена с другим списком
+    void swap(UnrolledSingleLinkedList& other) noexcept {
+        std::swap(head_.next_node, other.head_.next_node);
+        std::swap(tail_, other.tail_);
+        std::swap(size_, other.size_);
+        if (!head_.next_node)       tail_ = &head_;
+        if (!other.head_.next_node) other.tail_ = &other.head_;
+    }
+
+    // Функция получения размера
+    [[nodiscard]] size_t GetSize() const noexcept { return size_; }
+
+    // Функция проверки на пустоту
+    [[nodiscard]] bool IsEmpty() const noexcept { return size_ == 0u; }
+
+    // Функции доступа к первому и последнему элементам списка
+    [[nodiscard]] reference front() noexcept { assert(!IsEmpty()); return *begin(); }
+    [[nodiscard]] reference back()  noexcept { assert(!IsEmpty()); return *before_end(); }
+
+    // Функция добавления в начало списка
+    void PushFront(const Type& value) { EmplaceAfter(cbefore_begin(), value); }
+    void PushFront(Type&& value) { EmplaceAfter(cbefore_begin(), std::move(value)); }
+
+    // Функция удаления из начала списка
+    void PopFront() noexcept {
+        assert(!IsEmpty());
+        EraseAfter(cbefore_begin());
+    }
+
+    // Функция добавления в конец списка за O(1)
+    void PushBack(const Type& value) { EmplaceAfter(before_end(), value); }
+    void PushBack(Type&& value) { EmplaceAfter(before_end(), std::move(value)); }
+
+    // Функция добавления после элемента, на который указывает итератор
+    Iterator InsertAfter(ConstIterator pos, const Type& value) { return EmplaceAfter(pos, value); }
+    Iterator InsertAfter(ConstIterator pos, Type&& value) { return EmplaceAfter(pos, std::move(value)); }
+
+    // Функция создания элемента после элемента, на который указывает итератор. Элемент сначала создаётся
+    // вне списка, поэтому при исключении список не меняется
+    template <typename... Args>
+    Iterator EmplaceAfter(ConstIterator pos, Args&&... args) {
+        assert(pos.node_);
+
+        Type value(std::forward<Args>(args)...);
+        NodeBase* node = pos.node_;
+        size_t index = pos.index_ + 1u;
+
+        // Вставка в начало списка - это вставка в начало первого узла
+        if (node == &head_) {
+            node = head_.next_node;
+            index = 0u;
+            if (!node || node->count == N) {
+                return InsertIntoNewNode(&head_, std::move(value));
+            }
+        }
+
+        Node* target = static_cast<Node*>(node);
+        if (target->count < N) {
+            target->Insert(index, std::move(value));
+            ++size_;
+            return Iterator(target, index);
+        }
+
+        // Узел заполнен. Вставка в его конец идёт в начало следующего узла, если там есть место
+        if (index == N) {
+            Node* next = static_cast<Node*>(target->next_node);
+            if (next && next->count < N) {
+                next->Insert(0u, std::move(value));
+                ++size_;
+                return Iterator(next, 0u);
+            }
+            return InsertIntoNewNode(target, std::move(value));
+        }
+
+        // Иначе узел делится пополам
+        Node* half = CreateNodeAfter(target);
+        for (size_t i = N / 2u; i < N; ++i) {
+            target->MoveTo(i, *half, i - N / 2u);
+        }
+        half->count = N - N / 2u;
+        target->count = N / 2u;
+
+        if (index <= target->count) {
+            target->Insert(index, std::move(value));
+        } else {
+            index -= target->count;
+            target = half;
+            target->Insert(index, std::move(value));
+        }
+        ++size_;
+        return Iterator(target, index);
+    }
+
+    // Функция создания элемента в конце списка
+    template <typename... Args>
+    reference EmplaceBack(Args&&... args) {
+        return *EmplaceAfter(before_end(), std::forward<Args>(args)...);
+    }
+
+    // Функция удаления после элемента, на который указывает итератор
+    Iterator EraseAfter(ConstIterator pos) noexcept {
+        assert(pos.node_);
+
+        NodeBase* prev = pos.node_;
+        NodeBase* node_base = pos.node_;
+        size_t index = pos.index_ + 1u;
+        if (node_base == &head_ || index >= node_base->count) {
+            node_base = node_base->next_node;
+            index = 0u;
+        } else {
+            prev = nullptr; // Удаляемый элемент не последний в узле, узел не опустеет
+        }
+        assert(node_base);
+
+        Node* node = static_cast<Node*>(node_base);
+        node->Erase(index);
+        --size_;
+
+        // Опустевший узел удаляется
+        if (node->count == 0u) {
+            assert(prev);
+            NodeBase* next = node->next_node;
+            DeleteNodeAfter(prev);
+            return Iterator(next, 0u);
+        }
+
+        // Соседние узлы, заполненные меньше чем наполовину, объединяются
+        Node* next = static_cast<Node*>(node->next_node);
+        if (next && node->count + next->count <= N / 2u) {
+            for (size_t i = 0u; i < next->count; ++i) {
+                next->MoveTo(i, *node, node->count + i);
+            }
+            node->count += next->count;
+            next->count = 0u;
+            DeleteNodeAfter(node);
+        }
+
+        return index < node->count ? Iterator(node, index) : Iterator(node->next_node, 0u);
+    }
+
+    // Очистка списка
+    void Clear() noexcept {
+        while (head_.next_node) {
+            NodeBase* tmp = head_.next_node->next_node;
+            delete static_cast<Node*>(head_.next_node);
+            head_.next_node = tmp;
+        }
+
+        tail_ = &head_;
+        size_ = 0u;
+    }
+
+private:
+    NodeBase head_;           // Фиктивный узел
+    NodeBase* tail_ = &head_; // Последний узел (фиктивный, если список пуст)
+    size_t size_ = 0u;        // Размер списка
+
+    // Функция создания пустого узла после заданного
+    Node* CreateNodeAfter(NodeBase* prev) {
+        Node* node = new Node(prev->next_node);
+        prev->next_node = node;
+        if (prev == tail_) tail_ = node;
+        return node;
+    }
+
+    // Функция удаления (пустого или уже разрушенного) узла после заданного
+    void DeleteNodeAfter(NodeBase* prev) noexcept {
+        Node* node = static_cast<Node*>(prev->next_node);
+        assert(node->count == 0u);
+        prev->next_node = node->next_node;
+        if (node == tail_) tail_ = prev;
+        delete node;
+    }
+
+    // Функция вставки элемента в новый узел после заданного
+    Iterator InsertIntoNewNode(NodeBase* prev, Type&& value) {
+        Node* node = CreateNodeAfter(prev);
+        node->Insert(0u, std::move(value));
+        ++size_;
+        return Iterator(node, 0u);
+    }
+
+    // Функция для реализации идеомы copy-and-swap в конструкторе: создаёт список, инициализированный
+    // элементами в интервале [begin; end) и меняет его местами с текущим. Узлы заполняются полностью
+    template <typename ContainerIterator>
+    void CopyAndSwapFromIteratorRage(const ContainerIterator begin, const ContainerIterator end) {
+        UnrolledSingleLinkedList tmp;
+
+        for (ContainerIterator it = begin; it != end; ++it) {
+            Node* back = tmp.tail_ != &tmp.head_ && tmp.tail_->count < N
+                ? static_cast<Node*>(tmp.tail_) : tmp.CreateNodeAfter(tmp.tail_);
+            ::new (back->storage + back->count * sizeof(Type)) Type(*it);
+            ++back->count;
+            ++tmp.size_;
+        }
+
+        this->swap(tmp);
+    }
+};
+
+// Функция обмена формата swap(lhs, rhs)
+template <typename Type, size_t N>
+void swap(UnrolledSingleLinkedList<Type, N>& lhs, UnrolledSingleLinkedList<Type, N>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+// Оператор сравнения списков "=="
+template <typename Type, size_t N>
+bool operator == (const UnrolledSingleLinkedList<Type, N>& lhs, const UnrolledSingleLinkedList<Type, N>& rhs) {
+    return lhs.GetSize() == rhs.GetSize() && std::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin());
+}
+
+// Оператор сравнения списков "<"
+template <typename Type, size_t N>
+bool operator < (const UnrolledSingleLinkedList<Type, N>& lhs, const UnrolledSingleLinkedList<Type, N>& rhs) {
+    return std::lexicographical_compare(lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend());
+}
+
+// Производные от "==" и "<" операторы сравнения списков
+template <typename Type, size_t N>
+bool operator != (const UnrolledSingleLinkedList<Type, N>& lhs, const UnrolledSingleLinkedList<Type, N>& rhs) { return !(lhs == rhs); }
+
+template <typename Type, size_t N>
+bool operator >  (const UnrolledSingleLinkedList<Type, N>& lhs, const UnrolledSingleLinkedList<Type, N>& rhs) { return rhs < lhs; }
+
+template <typename Type, size_t N>
+bool operator <= (const UnrolledSingleLinkedList<Type, N>& lhs, const UnrolledSingleLinkedList<Type, N>& rhs) { return !(rhs < lhs); }
+
+template <typename Type, size_t N>
+bool operator >= (const UnrolledSingleLinkedList<Type, N>& lhs, const UnrolledSingleLinkedList<Type, N>& rhs) { return !(lhs < rhs); }
+
+// Оператор "<<" для вывода содержимого списка в поток
+template <typename Type, size_t N>
+std::ostream& operator << (std::ostream& os, const UnrolledSingleLinkedList<Type, N>& unrolled_list) {
+    using namespace std::literals;
+    os << "{"s;
+    bool first = true;
+    for (const Type& element : unrolled_list) {
+        if (!first) os << ", "s;
+        else        first = false;
+        os << element;
+    }
+    os << "}"s;
+    return os;
+}
\ No newline at end of file